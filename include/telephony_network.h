@@ -29,6 +29,10 @@ extern "C"
 /**
  * @file network_info.h
  * @brief This file contains the network information APIs.
+ * @remarks The functions can be called in any thread. The getters do not block each other, and they do not wait for the callback functions. \n
+ * The callback functions invoked in the key change notification are invoked one at a time, with the lock of the library held.
+ * They can call these functions in the same thread, but they must not wait for another thread which calls these functions, except the getters, or the two threads deadlock.
+ * To wait for such a thread, subscribe the event with #NETWORK_INFO_DISPATCH_CALLER_CONTEXT or #NETWORK_INFO_DISPATCH_THREAD.
  */
 
 /**
@@ -36,6 +40,49 @@ extern "C"
  * @{
  */
 
+/**
+ * @brief Creates a handle of the network information of a SIM slot.
+ *
+ * @details Each handle has its own cache and its own callback functions and subscriptions,
+ * so that several modules in a process do not replace the callback functions of each other.
+ * The handles of the same slot share the watches of the keys.
+ * The functions without handle work on a default handle of the slot 0.
+ *
+ * @remarks The flight mode is shared by all slots. \n
+ * The slot 1 is provided only by the in-memory store of the tests, because vconf has no keys of the second SIM. \n
+ * The recording follows the slot 0 only. \n
+ * @a handle must be released with network_info_destroy().
+ *
+ * @param[in] slot The SIM slot, 0 for the first SIM and 1 for the second SIM
+ * @param[out] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter, such as a slot out of range
+ * @retval #NETWORK_INFO_ERROR_NOT_SUPPORTED The slot is not provided by the store, such as the slot 1 on vconf
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @see	network_info_destroy()
+ *
+ */
+int network_info_create(int slot, network_info_h *handle);
+
+/**
+ * @brief Destroys a handle of the network information.
+ *
+ * @details The callback functions and the subscriptions of @a handle are removed, and its cache is disabled.
+ *
+ * @remarks This function can be called in the callback functions. \n
+ * It waits for the queued callback functions running in another thread as network_info_unsubscribe() does. \n
+ * @a handle and the subscription handles made with it must not be used after this function returns.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see	network_info_create()
+ *
+ */
+int network_info_destroy(network_info_h handle);
+
 /**
  * @brief Gets the LAC ( Location Area Code ) of current network.
  *
@@ -51,6 +98,24 @@ extern "C"
  */
 int network_info_get_lac(int *lac);
 
+/**
+ * @brief Gets the LAC ( Location Area Code ) of the network of a SIM slot.
+ *
+ * @details Same as network_info_get_lac(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] lac The Location Area Code
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_lac()
+ *
+ */
+int network_info_handle_get_lac(network_info_h handle, int *lac);
+
 /**
  * @brief Gets the cell ID.
  * 
@@ -66,6 +131,24 @@ int network_info_get_lac(int *lac);
  */
 int network_info_get_cell_id(int *cell_id);
 
+/**
+ * @brief Gets the cell ID of a SIM slot.
+ *
+ * @details Same as network_info_get_cell_id(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] cell_id The cell identification number
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_cell_id()
+ *
+ */
+int network_info_handle_get_cell_id(network_info_h handle, int *cell_id);
+
 /**
  * @brief Gets the RSSI (Received Signal Strength Indicator).
  *
@@ -83,6 +166,24 @@ int network_info_get_cell_id(int *cell_id);
  */
 int network_info_get_rssi(network_info_rssi_e *rssi);
 
+/**
+ * @brief Gets the RSSI (Received Signal Strength Indicator) of a SIM slot.
+ *
+ * @details Same as network_info_get_rssi(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] rssi The Received Signal Strength Indicator
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_rssi()
+ *
+ */
+int network_info_handle_get_rssi(network_info_h handle, network_info_rssi_e *rssi);
+
 /**
  * @brief Gets the roaming state.
  *
@@ -98,6 +199,24 @@ int network_info_get_rssi(network_info_rssi_e *rssi);
  */
 int network_info_is_roaming(bool *is_roaming);
 
+/**
+ * @brief Gets the roaming state of a SIM slot.
+ *
+ * @details Same as network_info_is_roaming(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] is_roaming @c true if roaming, otherwise @c false
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_is_roaming()
+ *
+ */
+int network_info_handle_is_roaming(network_info_h handle, bool *is_roaming);
+
 /**
  * @brief Gets the MCC (Mobile Country Code) of current network. 
  *
@@ -118,12 +237,31 @@ int network_info_is_roaming(bool *is_roaming);
  */
 int network_info_get_mcc(char **mcc);
 
+/**
+ * @brief Gets the MCC (Mobile Country Code) of the network of a SIM slot.
+ *
+ * @details Same as network_info_get_mcc(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] mcc The Mobile Country Code, which must be released with free()
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_mcc()
+ *
+ */
+int network_info_handle_get_mcc(network_info_h handle, char **mcc);
+
 /**
  * @brief Gets the MNC (Mobile Network Code) of current network.
  *
  * @remarks @a mnc must be released with free() by you.
  *
- * @param[out] mnc The Mobile Network Code (three digits). \n
+ * @param[out] mnc The Mobile Network Code (two or three digits). \n
  * The Mobile Network Code (MNC) identifies the mobile phone operator and network provider.
  *
  * @return 0 on success, otherwise a negative error value.
@@ -139,27 +277,31 @@ int network_info_get_mcc(char **mcc);
 int network_info_get_mnc(char **mnc);
 
 /**
- * @brief Gets the name of the network provider.
+ * @brief Gets the MNC (Mobile Network Code) of the network of a SIM slot.
  *
- * @remarks @a provider_name must be released with free() by you.
+ * @details Same as network_info_get_mnc(), for the SIM slot of @a handle.
  *
- * @param[out] provider_name The name of the network provider
+ * @param[in] handle The network information handle
+ * @param[out] mnc The Mobile Network Code, which must be released with free()
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
  * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
  * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
  * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
- * @pre The Network service state must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
- * @see	network_info_get_service_state()
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_mnc()
  *
  */
-int network_info_get_provider_name(char **provider_name);
+int network_info_handle_get_mnc(network_info_h handle, char **mnc);
 
 /**
- * @brief Gets the network type.
+ * @brief Gets the PLMN (Public Land Mobile Network) of current network.
  *
- * @param[out] network_type The network type of telephony
+ * @details Unlike network_info_get_mcc() and network_info_get_mnc(), MCC and MNC are read at once without memory allocation,
+ * and MNC has its exact number of digits.
  *
+ * @param[out] plmn The MCC and MNC of current network
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
  * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
@@ -169,175 +311,1152 @@ int network_info_get_provider_name(char **provider_name);
  * @see	network_info_get_service_state()
  *
  */
-int network_info_get_type(network_info_type_e *network_type);
+int network_info_get_plmn(network_info_plmn_s *plmn);
 
 /**
- * @brief Gets the network state of the telephony service. 
+ * @brief Gets the PLMN (Public Land Mobile Network) of the network of a SIM slot.
  *
- * @remarks To know the state of data network, call connection_get_network_status() in Connection Service.
- * @param[out] network_service_state The network state of call service
+ * @details Same as network_info_get_plmn(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] plmn The PLMN
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
- * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
  * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_plmn()
  *
  */
-int network_info_get_service_state(network_info_service_state_e *network_service_state);
+int network_info_handle_get_plmn(network_info_h handle, network_info_plmn_s *plmn);
 
 /**
- * @brief  Called when the cell ID changes.
- * @remarks If the cell ID changes, then LAC, MCC, MNC, provider name and network type can be changed.
- * @param [in] cell_id The cell identification number to be changed
- * @param [in] user_data The user data passed from the callback registration function
- * @pre This callback function is invoked if you register this function using network_info_set_cell_id_changed_cb().
- * @see network_info_set_cell_id_changed_cb()
- * @see network_info_unset_cell_id_changed_cb()
+ * @brief Gets the name of the network provider.
+ *
+ * @remarks @a provider_name must be released with free() by you.
+ *
+ * @param[out] provider_name The name of the network provider
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_service_state()
+ *
  */
-typedef void(* network_info_cell_id_changed_cb)(int cell_id, void *user_data);
+int network_info_get_provider_name(char **provider_name);
 
 /**
- * @brief Registers a callback function to be invoked when the cell ID changes. 
+ * @brief Gets the name of the network provider of a SIM slot.
  *
- * @param [in] callback The callback function to register
- * @param [in] user_data The user data to be passed to the callback function
+ * @details Same as network_info_get_provider_name(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] provider_name The name of the network provider, which must be released with free()
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
  * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
  * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
- * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
- * @post network_info_cell_id_changed_cb() will be invoked. 
- * @see network_info_cell_id_changed_cb()
- * @see	network_info_unset_cell_id_changed_cb() 
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_provider_name()
  *
  */
-int network_info_set_cell_id_changed_cb(network_info_cell_id_changed_cb callback, void *user_data);
+int network_info_handle_get_provider_name(network_info_h handle, char **provider_name);
 
 /**
- * @brief Unregisters the callback function.
- * 
+ * @brief Copies the name of the network provider into a buffer.
+ *
+ * @details While the changes of the name are subscribed on the SIM slot, such as with network_info_set_provider_name_changed_cb(),
+ * the name is kept up to date by the library, so no memory is allocated and no key is read. Otherwise the name is read from the store.
+ * @a generation is increased whenever the name changes, so the caller can tell whether the name differs from the one copied before.
+ *
+ * @remarks The name is cut before the UTF-8 character which does not fit in @a buffer, or which is beyond #NETWORK_INFO_PROVIDER_NAME_LEN_MAX bytes.
+ * network_info_get_provider_name() gets the full name.
+ *
+ * @param[out] buffer The buffer to which the null-terminated name is copied
+ * @param[in] buffer_size The size of @a buffer in bytes
+ * @param[out] generation The generation of the name, or NULL if it is not needed
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
- * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
- * @see network_info_cell_id_changed_cb()
- * @see	network_info_set_cell_id_changed_cb()
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_provider_name()
+ * @see	network_info_set_provider_name_changed_cb()
  *
  */
-int network_info_unset_cell_id_changed_cb();
+int network_info_copy_provider_name(char *buffer, int buffer_size, unsigned int *generation);
 
 /**
- * @brief Invoked when the RSSI (Received Signal Strength Indicator) changes.
- * @param [in] rssi The Received Signal Strength Indicator
- * @param [in] user_data The user data passed from the callback registration function
- * @pre This callback function is invoked if you register this function using network_info_set_rssi_changed_cb().
- * @see network_info_set_rssi_changed_cb()
- * @see network_info_unset_rssi_changed_cb()
+ * @brief Copies the name of the network provider of a SIM slot into a buffer.
+ *
+ * @details Same as network_info_copy_provider_name(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] buffer The buffer to which the null-terminated name is copied
+ * @param[in] buffer_size The size of @a buffer in bytes
+ * @param[out] generation The generation of the name, or NULL if it is not needed
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_copy_provider_name()
+ *
  */
-typedef void(* network_info_rssi_changed_cb)(network_info_rssi_e rssi, void *user_data);
+int network_info_handle_copy_provider_name(network_info_h handle, char *buffer, int buffer_size, unsigned int *generation);
 
 /**
- * @brief Registers a callback function to be invoked when RSSI (Received Signal Strength Indicator) changes. 
+ * @brief Gets the network type.
+ *
+ * @param[out] network_type The network type of telephony
  *
- * @param [in] callback The callback function to register
- * @param [in] user_data The user data to be passed to the callback function
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
  * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
  * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
- * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
- * @post network_info_rssi_changed_cb() will be invoked. 
- * @see network_info_rssi_changed_cb()
- * @see	network_info_unset_rssi_changed_cb()
+ * @pre The Network service state must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_service_state()
  *
  */
-int network_info_set_rssi_changed_cb(network_info_rssi_changed_cb callback, void *user_data);
+int network_info_get_type(network_info_type_e *network_type);
 
 /**
- * @brief Unregisters the callback function.
- * 
+ * @brief Gets the network type of a SIM slot.
+ *
+ * @details Same as network_info_get_type(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] network_type The network type of telephony
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
- * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
- * @see network_info_rssi_changed_cb()
- * @see	network_info_set_rssi_changed_cb()
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_type()
  *
  */
-int network_info_unset_rssi_changed_cb();
+int network_info_handle_get_type(network_info_h handle, network_info_type_e *network_type);
 
 /**
- * @brief Invoked when the roaming state changes.
- * @param [in] is_roaming The roaming state
- * @param [in] user_data The user data passed from the callback registration function
- * @pre This callback function is invoked if you register this function using network_info_set_roaming_state_changed_cb().
- * @see network_info_set_roaming_state_changed_cb()
- * @see network_info_unset_roaming_state_changed_cb()
+ * @brief Gets the network state of the telephony service. 
+ *
+ * @remarks To know the state of data network, call connection_get_network_status() in Connection Service.
+ * @param[out] network_service_state The network state of call service
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ *
  */
-typedef void(* network_info_roaming_state_changed_cb)(bool is_roaming, void *user_data);
+int network_info_get_service_state(network_info_service_state_e *network_service_state);
 
 /**
- * @brief Registers a callback function to be invoked when roaming state changes. 
+ * @brief Gets the network state of the telephony service of a SIM slot.
  *
- * @param [in] callback The callback function to register
- * @param [in] user_data The user data to be passed to the callback function
+ * @details Same as network_info_get_service_state(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] network_service_state The network state of call service
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
  * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
- * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
- * @post network_info_roaming_state_changed_cb() will be invoked. 
- * @see network_info_roaming_state_changed_cb()
- * @see	network_info_unset_roaming_state_changed_cb()
+ * @see	network_info_get_service_state()
  *
  */
-int network_info_set_roaming_state_changed_cb(network_info_roaming_state_changed_cb callback, void *user_data);
+int network_info_handle_get_service_state(network_info_h handle, network_info_service_state_e *network_service_state);
 
 /**
- * @brief Unregisters the callback function.
- * 
+ * @brief Gets all network information at once.
+ *
+ * @details The service state, network type, LAC, cell ID, RSSI, roaming state, MCC, MNC and provider name
+ * are read in one request, instead of one request for each value.
+ *
+ * @remarks If the service state is not #NETWORK_INFO_SERVICE_STATE_IN_SERVICE, only @a service_state of @a snapshot is filled. \n
+ * The keys are still read one after another by the store, and the platform writes them one after another,
+ * so a change made during the read, such as a handover, may be seen partly.
+ *
+ * @param[out] snapshot The network information
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
- * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
- * @see network_info_roaming_state_changed_cb()
- * @see	network_info_set_roaming_changed_cb()
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see	network_info_get_service_state()
  *
  */
-int network_info_unset_roaming_state_changed_cb();
+int network_info_get_snapshot(network_info_snapshot_s *snapshot);
 
 /**
- * @brief Invoked when the state of the telephony service changes. 
- * @param [in] network_service_state The state of telephony service
- * @param [in] user_data The user data passed from the callback registration function
- * @pre This callback function is invoked if you register this function using network_info_set_service_state_changed_cb().
- * @see #network_info_service_state_e
- * @see network_info_set_service_state_changed_cb()
- * @see  network_info_unset_service_state_changed_cb()
+ * @brief Gets all network information of a SIM slot at once.
+ *
+ * @details Same as network_info_get_snapshot(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] snapshot The network information
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see	network_info_get_snapshot()
+ *
  */
-typedef void(* network_info_service_state_changed_cb)(network_info_service_state_e network_service_state, void *user_data);
+int network_info_handle_get_snapshot(network_info_h handle, network_info_snapshot_s *snapshot);
 
 /**
- * @brief Registers a callback function to be invoked when telephony service state changes.
+ * @brief Gets the PLMN, LAC and cell ID of the serving cell at once.
  *
- * @param [in] callback The callback function to register
- * @param [in] user_data The user data to be passed to the callback function
+ * @details Unlike separate calls of network_info_get_plmn(), network_info_get_lac() and network_info_get_cell_id(),
+ * the values are read in one request, so the window in which a new cell ID can be paired with an old LAC is much shorter.
+ *
+ * @remarks The keys are still read one after another by the store, and the platform writes them one after another,
+ * so a handover made during the read may be seen partly. #NETWORK_INFO_EVENT_SERVING_CELL delivers the values again once the change is complete.
+ *
+ * @param[out] serving_cell The identity of the serving cell
  * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
  * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
  * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
- * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
- * @post network_info_service_state_changed_cb() will be invoked. 
- * @see	network_info_unset_service_state_changed_cb()
+ * @pre  The Network service state must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see #NETWORK_INFO_EVENT_SERVING_CELL
+ *
  */
-int network_info_set_service_state_changed_cb(network_info_service_state_changed_cb callback, void *user_data);
+int network_info_get_serving_cell(network_info_serving_cell_s *serving_cell);
 
 /**
- * @brief Unregisters the callback function. 
- * 
- * @return 0 on success, otherwise a negative error value.
+ * @brief Gets the PLMN, LAC and cell ID of the serving cell of a SIM slot at once.
+ *
+ * @details Same as network_info_get_serving_cell(), for the SIM slot of @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[out] serving_cell The identity of the serving cell
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @pre The Network service state of the slot must be #NETWORK_INFO_SERVICE_STATE_IN_SERVICE.
+ * @see	network_info_get_serving_cell()
+ *
+ */
+int network_info_handle_get_serving_cell(network_info_h handle, network_info_serving_cell_s *serving_cell);
+
+/**
+ * @brief Called with the result of network_info_get_snapshot_async().
+ * @param [in] result The result of the read, as returned by network_info_get_snapshot()
+ * @param [in] snapshot The network information, valid only during the callback
+ * @param [in] user_data The user data passed from network_info_get_snapshot_async()
+ * @see network_info_get_snapshot_async()
+ */
+typedef void(* network_info_snapshot_cb)(int result, network_info_snapshot_s *snapshot, void *user_data);
+
+/**
+ * @brief Called with the result of network_info_get_serving_cell_async().
+ * @param [in] result The result of the read, as returned by network_info_get_serving_cell()
+ * @param [in] serving_cell The identity of the serving cell, valid only during the callback
+ * @param [in] user_data The user data passed from network_info_get_serving_cell_async()
+ * @see network_info_get_serving_cell_async()
+ */
+typedef void(* network_info_serving_cell_cb)(int result, network_info_serving_cell_s *serving_cell, void *user_data);
+
+/**
+ * @brief Gets all network information at once without blocking the calling thread.
+ *
+ * @details The keys are read on another thread, and @a callback is invoked on the thread-default main context of the calling thread.
+ * The requests made before a read in progress finishes share the result of that read.
+ *
+ * @param [in] callback The callback function to be invoked with the result
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_snapshot_cb() will be invoked.
+ * @see	network_info_get_snapshot()
+ *
+ */
+int network_info_get_snapshot_async(network_info_snapshot_cb callback, void *user_data);
+
+/**
+ * @brief Gets all network information of a SIM slot at once without blocking the calling thread.
+ *
+ * @details Same as network_info_get_snapshot_async(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to be invoked with the result
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_snapshot_cb() will be invoked.
+ * @see	network_info_get_snapshot_async()
+ *
+ */
+int network_info_handle_get_snapshot_async(network_info_h handle, network_info_snapshot_cb callback, void *user_data);
+
+/**
+ * @brief Gets the PLMN, LAC and cell ID of the serving cell at once without blocking the calling thread.
+ *
+ * @details The keys are read on another thread, and @a callback is invoked on the thread-default main context of the calling thread.
+ * The requests made before a read in progress finishes share the result of that read.
+ *
+ * @param [in] callback The callback function to be invoked with the result
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_serving_cell_cb() will be invoked.
+ * @see	network_info_get_serving_cell()
+ *
+ */
+int network_info_get_serving_cell_async(network_info_serving_cell_cb callback, void *user_data);
+
+/**
+ * @brief Gets the PLMN, LAC and cell ID of the serving cell of a SIM slot at once without blocking the calling thread.
+ *
+ * @details Same as network_info_get_serving_cell_async(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to be invoked with the result
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_serving_cell_cb() will be invoked.
+ * @see	network_info_get_serving_cell_async()
+ *
+ */
+int network_info_handle_get_serving_cell_async(network_info_h handle, network_info_serving_cell_cb callback, void *user_data);
+
+/**
+ * @brief Enables the cache of network information.
+ *
+ * @details While the cache is enabled, the library watches every key it exposes and
+ * the getters return the cached values without reading them again.
+ *
+ * @remarks The cache is updated by the key change notifications which are dispatched in the main loop. \n
+ * If the cache cannot be filled, the getters read the values directly until network_info_refresh_cache() succeeds.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see	network_info_disable_cache()
+ * @see	network_info_refresh_cache()
+ *
+ */
+int network_info_enable_cache();
+
+/**
+ * @brief Enables the cache of network information for a handle.
+ *
+ * @details Same as network_info_enable_cache(), for @a handle.
+ * The cached values are shared by the handles of the same slot, but only the handles which enable the cache use them.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see	network_info_enable_cache()
+ *
+ */
+int network_info_handle_enable_cache(network_info_h handle);
+
+/**
+ * @brief Disables the cache of network information.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @see	network_info_enable_cache()
+ *
+ */
+int network_info_disable_cache();
+
+/**
+ * @brief Disables the cache of network information for a handle.
+ *
+ * @details Same as network_info_disable_cache(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see	network_info_disable_cache()
+ *
+ */
+int network_info_handle_disable_cache(network_info_h handle);
+
+/**
+ * @brief Reads all network information again and replaces the cached values.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error or the cache is not enabled
+ * @pre The cache must be enabled by network_info_enable_cache().
+ * @see	network_info_enable_cache()
+ *
+ */
+int network_info_refresh_cache();
+
+/**
+ * @brief Reads all network information of a SIM slot again and replaces the cached values.
+ *
+ * @details Same as network_info_refresh_cache(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error or the cache is not enabled for @a handle
+ * @see	network_info_refresh_cache()
+ *
+ */
+int network_info_handle_refresh_cache(network_info_h handle);
+
+/**
+ * @brief  Called when the cell ID changes.
+ * @remarks If the cell ID changes, then LAC, MCC, MNC, provider name and network type can be changed.
+ * @param [in] cell_id The cell identification number to be changed
+ * @param [in] user_data The user data passed from the callback registration function
+ * @pre This callback function is invoked if you register this function using network_info_set_cell_id_changed_cb().
+ * @see network_info_set_cell_id_changed_cb()
+ * @see network_info_unset_cell_id_changed_cb()
+ */
+typedef void(* network_info_cell_id_changed_cb)(int cell_id, void *user_data);
+
+/**
+ * @brief Registers a callback function to be invoked when the cell ID changes. 
+ *
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
+ * @post network_info_cell_id_changed_cb() will be invoked. 
+ * @see network_info_cell_id_changed_cb()
+ * @see	network_info_unset_cell_id_changed_cb() 
+ *
+ */
+int network_info_set_cell_id_changed_cb(network_info_cell_id_changed_cb callback, void *user_data);
+
+/**
+ * @brief Registers a callback function of a handle to be invoked when the cell ID changes.
+ *
+ * @details Same as network_info_set_cell_id_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_cell_id_changed_cb() will be invoked.
+ * @see	network_info_set_cell_id_changed_cb()
+ *
+ */
+int network_info_handle_set_cell_id_changed_cb(network_info_h handle, network_info_cell_id_changed_cb callback, void *user_data);
+
+/**
+ * @brief Unregisters the callback function.
+ * 
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see network_info_cell_id_changed_cb()
+ * @see	network_info_set_cell_id_changed_cb()
+ *
+ */
+int network_info_unset_cell_id_changed_cb();
+
+/**
+ * @brief Unregisters the callback function of a handle.
+ *
+ * @details Same as network_info_unset_cell_id_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see	network_info_unset_cell_id_changed_cb()
+ *
+ */
+int network_info_handle_unset_cell_id_changed_cb(network_info_h handle);
+
+/**
+ * @brief Invoked when the RSSI (Received Signal Strength Indicator) changes.
+ * @param [in] rssi The Received Signal Strength Indicator
+ * @param [in] user_data The user data passed from the callback registration function
+ * @pre This callback function is invoked if you register this function using network_info_set_rssi_changed_cb().
+ * @see network_info_set_rssi_changed_cb()
+ * @see network_info_unset_rssi_changed_cb()
+ */
+typedef void(* network_info_rssi_changed_cb)(network_info_rssi_e rssi, void *user_data);
+
+/**
+ * @brief Registers a callback function to be invoked when RSSI (Received Signal Strength Indicator) changes. 
+ *
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
+ * @post network_info_rssi_changed_cb() will be invoked. 
+ * @see network_info_rssi_changed_cb()
+ * @see	network_info_unset_rssi_changed_cb()
+ *
+ */
+int network_info_set_rssi_changed_cb(network_info_rssi_changed_cb callback, void *user_data);
+
+/**
+ * @brief Registers a callback function of a handle to be invoked when RSSI (Received Signal Strength Indicator) changes.
+ *
+ * @details Same as network_info_set_rssi_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_rssi_changed_cb() will be invoked.
+ * @see	network_info_set_rssi_changed_cb()
+ *
+ */
+int network_info_handle_set_rssi_changed_cb(network_info_h handle, network_info_rssi_changed_cb callback, void *user_data);
+
+/**
+ * @brief Unregisters the callback function.
+ * 
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see network_info_rssi_changed_cb()
+ * @see	network_info_set_rssi_changed_cb()
+ *
+ */
+int network_info_unset_rssi_changed_cb();
+
+/**
+ * @brief Unregisters the callback function of a handle.
+ *
+ * @details Same as network_info_unset_rssi_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see	network_info_unset_rssi_changed_cb()
+ *
+ */
+int network_info_handle_unset_rssi_changed_cb(network_info_h handle);
+
+/**
+ * @brief Invoked when the roaming state changes.
+ * @param [in] is_roaming The roaming state
+ * @param [in] user_data The user data passed from the callback registration function
+ * @pre This callback function is invoked if you register this function using network_info_set_roaming_state_changed_cb().
+ * @see network_info_set_roaming_state_changed_cb()
+ * @see network_info_unset_roaming_state_changed_cb()
+ */
+typedef void(* network_info_roaming_state_changed_cb)(bool is_roaming, void *user_data);
+
+/**
+ * @brief Registers a callback function to be invoked when roaming state changes. 
+ *
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
+ * @post network_info_roaming_state_changed_cb() will be invoked. 
+ * @see network_info_roaming_state_changed_cb()
+ * @see	network_info_unset_roaming_state_changed_cb()
+ *
+ */
+int network_info_set_roaming_state_changed_cb(network_info_roaming_state_changed_cb callback, void *user_data);
+
+/**
+ * @brief Registers a callback function of a handle to be invoked when roaming state changes.
+ *
+ * @details Same as network_info_set_roaming_state_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_roaming_state_changed_cb() will be invoked.
+ * @see	network_info_set_roaming_state_changed_cb()
+ *
+ */
+int network_info_handle_set_roaming_state_changed_cb(network_info_h handle, network_info_roaming_state_changed_cb callback, void *user_data);
+
+/**
+ * @brief Unregisters the callback function.
+ * 
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see network_info_roaming_state_changed_cb()
+ * @see	network_info_set_roaming_changed_cb()
+ *
+ */
+int network_info_unset_roaming_state_changed_cb();
+
+/**
+ * @brief Unregisters the callback function of a handle.
+ *
+ * @details Same as network_info_unset_roaming_state_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see	network_info_unset_roaming_state_changed_cb()
+ *
+ */
+int network_info_handle_unset_roaming_state_changed_cb(network_info_h handle);
+
+/**
+ * @brief Invoked when the state of the telephony service changes. 
+ * @param [in] network_service_state The state of telephony service
+ * @param [in] user_data The user data passed from the callback registration function
+ * @pre This callback function is invoked if you register this function using network_info_set_service_state_changed_cb().
+ * @see #network_info_service_state_e
+ * @see network_info_set_service_state_changed_cb()
+ * @see  network_info_unset_service_state_changed_cb()
+ */
+typedef void(* network_info_service_state_changed_cb)(network_info_service_state_e network_service_state, void *user_data);
+
+/**
+ * @brief Registers a callback function to be invoked when telephony service state changes.
+ *
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
+ * @post network_info_service_state_changed_cb() will be invoked. 
+ * @see	network_info_unset_service_state_changed_cb()
+ */
+int network_info_set_service_state_changed_cb(network_info_service_state_changed_cb callback, void *user_data);
+
+/**
+ * @brief Registers a callback function of a handle to be invoked when telephony service state changes.
+ *
+ * @details Same as network_info_set_service_state_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_service_state_changed_cb() will be invoked.
+ * @see	network_info_set_service_state_changed_cb()
+ *
+ */
+int network_info_handle_set_service_state_changed_cb(network_info_h handle, network_info_service_state_changed_cb callback, void *user_data);
+
+/**
+ * @brief Unregisters the callback function. 
+ * 
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see network_info_service_state_changed_cb()
+ * @see	network_info_set_service_state_changed_cb()
+ */
+int network_info_unset_service_state_changed_cb();
+
+/**
+ * @brief Unregisters the callback function of a handle.
+ *
+ * @details Same as network_info_unset_service_state_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
  * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
- * @see network_info_service_state_changed_cb()
- * @see	network_info_set_service_state_changed_cb()
+ * @see	network_info_unset_service_state_changed_cb()
+ *
  */
-int network_info_unset_service_state_changed_cb();
+int network_info_handle_unset_service_state_changed_cb(network_info_h handle);
+
+/**
+ * @brief Invoked when the name of the network provider changes.
+ * @param [in] provider_name The name of the network provider, valid only during the callback, cut like by network_info_copy_provider_name()
+ * @param [in] user_data The user data passed from the callback registration function
+ * @pre This callback function is invoked if you register this function using network_info_set_provider_name_changed_cb().
+ * @see network_info_set_provider_name_changed_cb()
+ * @see network_info_unset_provider_name_changed_cb()
+ */
+typedef void(* network_info_provider_name_changed_cb)(const char *provider_name, void *user_data);
+
+/**
+ * @brief Registers a callback function to be invoked when the name of the network provider changes.
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_provider_name_changed_cb() will be invoked.
+ * @see network_info_provider_name_changed_cb()
+ * @see	network_info_unset_provider_name_changed_cb()
+ */
+int network_info_set_provider_name_changed_cb(network_info_provider_name_changed_cb callback, void *user_data);
+
+/**
+ * @brief Registers a callback function of a handle to be invoked when the name of the network provider changes.
+ *
+ * @details Same as network_info_set_provider_name_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_provider_name_changed_cb() will be invoked.
+ * @see	network_info_set_provider_name_changed_cb()
+ *
+ */
+int network_info_handle_set_provider_name_changed_cb(network_info_h handle, network_info_provider_name_changed_cb callback, void *user_data);
+
+/**
+ * @brief Unregisters the callback function.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see network_info_provider_name_changed_cb()
+ * @see	network_info_set_provider_name_changed_cb()
+ */
+int network_info_unset_provider_name_changed_cb();
+
+/**
+ * @brief Unregisters the callback function of a handle.
+ *
+ * @details Same as network_info_unset_provider_name_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see	network_info_unset_provider_name_changed_cb()
+ *
+ */
+int network_info_handle_unset_provider_name_changed_cb(network_info_h handle);
+
+/**
+ * @brief Invoked when the network type changes.
+ * @details The callback is invoked only when the type mapped from the service type changes, and only in service.
+ * @param [in] network_type The network type
+ * @param [in] user_data The user data passed from the callback registration function
+ * @pre This callback function is invoked if you register this function using network_info_set_type_changed_cb().
+ * @see network_info_set_type_changed_cb()
+ * @see network_info_unset_type_changed_cb()
+ */
+typedef void(* network_info_type_changed_cb)(network_info_type_e network_type, void *user_data);
+
+/**
+ * @brief Registers a callback function to be invoked when the network type changes.
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_type_changed_cb() will be invoked.
+ * @see network_info_type_changed_cb()
+ * @see	network_info_unset_type_changed_cb()
+ * @see	network_info_get_type()
+ */
+int network_info_set_type_changed_cb(network_info_type_changed_cb callback, void *user_data);
+
+/**
+ * @brief Registers a callback function of a handle to be invoked when the network type changes.
+ *
+ * @details Same as network_info_set_type_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_type_changed_cb() will be invoked.
+ * @see	network_info_set_type_changed_cb()
+ *
+ */
+int network_info_handle_set_type_changed_cb(network_info_h handle, network_info_type_changed_cb callback, void *user_data);
+
+/**
+ * @brief Unregisters the callback function.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see network_info_type_changed_cb()
+ * @see	network_info_set_type_changed_cb()
+ */
+int network_info_unset_type_changed_cb();
+
+/**
+ * @brief Unregisters the callback function of a handle.
+ *
+ * @details Same as network_info_unset_type_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see	network_info_unset_type_changed_cb()
+ *
+ */
+int network_info_handle_unset_type_changed_cb(network_info_h handle);
+
+/**
+ * @brief Invoked when the PLMN of the current network changes, for example when the device moves to a roaming partner.
+ * @details The callback is invoked only in service.
+ * @param [in] plmn The MCC and MNC of the current network, valid only during the callback
+ * @param [in] user_data The user data passed from the callback registration function
+ * @pre This callback function is invoked if you register this function using network_info_set_plmn_changed_cb().
+ * @see network_info_set_plmn_changed_cb()
+ * @see network_info_unset_plmn_changed_cb()
+ */
+typedef void(* network_info_plmn_changed_cb)(const network_info_plmn_s *plmn, void *user_data);
+
+/**
+ * @brief Registers a callback function to be invoked when the PLMN of the current network changes.
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @post network_info_plmn_changed_cb() will be invoked.
+ * @see network_info_plmn_changed_cb()
+ * @see	network_info_unset_plmn_changed_cb()
+ * @see	network_info_get_plmn()
+ */
+int network_info_set_plmn_changed_cb(network_info_plmn_changed_cb callback, void *user_data);
+
+/**
+ * @brief Registers a callback function of a handle to be invoked when the PLMN of the current network changes.
+ *
+ * @details Same as network_info_set_plmn_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @post network_info_plmn_changed_cb() will be invoked.
+ * @see	network_info_set_plmn_changed_cb()
+ *
+ */
+int network_info_handle_set_plmn_changed_cb(network_info_h handle, network_info_plmn_changed_cb callback, void *user_data);
+
+/**
+ * @brief Unregisters the callback function.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see network_info_plmn_changed_cb()
+ * @see	network_info_set_plmn_changed_cb()
+ */
+int network_info_unset_plmn_changed_cb();
+
+/**
+ * @brief Unregisters the callback function of a handle.
+ *
+ * @details Same as network_info_unset_plmn_changed_cb(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see	network_info_unset_plmn_changed_cb()
+ *
+ */
+int network_info_handle_unset_plmn_changed_cb(network_info_h handle);
+
+/**
+ * @brief Invoked when the subscribed event occurs.
+ * @param [in] event The event
+ * @param [in] data The new value of the event. The type of the value depends on @a event, see #network_info_event_e.
+ * @param [in] user_data The user data passed from the subscription function
+ * @pre This callback function is invoked if you subscribe the event using network_info_subscribe().
+ * @see network_info_subscribe()
+ * @see network_info_unsubscribe()
+ */
+typedef void(* network_info_event_cb)(network_info_event_e event, void *data, void *user_data);
+
+/**
+ * @brief Subscribes an event.
+ *
+ * @details Unlike network_info_set_*_changed_cb(), any number of callback functions can be subscribed to the same event.
+ *
+ * @remarks @a callback is invoked with the lock of the library held, unless the dispatch mode is changed by network_info_subscription_set_dispatch_mode(),
+ * so it must not wait for another thread which calls the functions of this library other than the getters.
+ *
+ * @param [in] event The event to subscribe
+ * @param [in] callback The callback function to register
+ * @param [in] user_data The user data to be passed to the callback function
+ * @param [out] subscription The subscription handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service 
+ * @post network_info_event_cb() will be invoked. 
+ * @see network_info_event_cb()
+ * @see	network_info_unsubscribe()
+ *
+ */
+int network_info_subscribe(network_info_event_e event, network_info_event_cb callback, void *user_data, network_info_subscription_h *subscription);
+
+/**
+ * @brief Subscribes an event of a SIM slot.
+ *
+ * @details Same as network_info_subscribe(), for @a handle.
+ *
+ * @param[in] handle The network information handle
+ * @param[in] event The event to subscribe
+ * @param[in] callback The callback function to register
+ * @param[in] user_data The user data to be passed to the callback function
+ * @param[out] subscription The subscription handle, removed with network_info_unsubscribe()
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_SERVICE Out of service
+ * @post network_info_event_cb() will be invoked.
+ * @see	network_info_subscribe()
+ *
+ */
+int network_info_handle_subscribe(network_info_h handle, network_info_event_e event, network_info_event_cb callback, void *user_data, network_info_subscription_h *subscription);
+
+/**
+ * @brief Unsubscribes an event.
+ *
+ * @remarks This function can be called in network_info_event_cb(). \n
+ * If the callback function of @a subscription is running in another thread with a queued dispatch mode, this function waits until it returns,
+ * so that the user data can be released after this function returns. It does not wait if it is called in a callback function invoked inline,
+ * because the callback function running in another thread may be waiting for the lock held there. \n
+ * @a subscription must not be used after this function returns.
+ *
+ * @param [in] subscription The subscription handle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Operation failed
+ * @see network_info_subscribe()
+ *
+ */
+int network_info_unsubscribe(network_info_subscription_h subscription);
+
+/**
+ * @brief Sets the delivery policy of RSSI subscription.
+ *
+ * @details By default, every change of RSSI is delivered at once.
+ * With a policy, changes of RSSI are coalesced to reduce the number of deliveries.
+ *
+ * @remarks The deliveries which are delayed by the policy are made in the main loop.
+ *
+ * @param [in] subscription The subscription handle of #NETWORK_INFO_EVENT_RSSI
+ * @param [in] policy The delivery policy, or @c NULL to deliver every change at once
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @see network_info_subscribe()
+ *
+ */
+int network_info_subscription_set_rssi_policy(network_info_subscription_h subscription, const network_info_rssi_policy_s *policy);
+
+/**
+ * @brief Sets the thresholds of RSSI subscription, so that only the changes crossing a threshold are delivered.
+ *
+ * @details A threshold @a t divides the levels into the bands below @a t and at or above @a t.
+ * A change of RSSI is delivered only when the old and the new level are in different bands, for example
+ * with the threshold #NETWORK_INFO_RSSI_2, a change from #NETWORK_INFO_RSSI_3 to #NETWORK_INFO_RSSI_1 is delivered, but not a change to #NETWORK_INFO_RSSI_2.
+ * The crossed thresholds are found once for each change, and the subscriptions which are not affected are not woken.
+ *
+ * @remarks The policy set by network_info_subscription_set_rssi_policy() is applied to the changes which cross a threshold.
+ *
+ * @param [in] subscription The subscription handle of #NETWORK_INFO_EVENT_RSSI
+ * @param [in] thresholds The thresholds from #NETWORK_INFO_RSSI_1 to #NETWORK_INFO_RSSI_6, or @c NULL to deliver every change
+ * @param [in] count The number of @a thresholds
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see network_info_subscribe()
+ *
+ */
+int network_info_subscription_set_rssi_thresholds(network_info_subscription_h subscription, const network_info_rssi_e *thresholds, int count);
+
+/**
+ * @brief Sets the way the callback function of the subscription is invoked.
+ *
+ * @details By default, the callback function is invoked in the key change notification (#NETWORK_INFO_DISPATCH_INLINE),
+ * so a slow callback function delays the notifications of the other subscriptions.
+ * With the other modes, the events are copied and queued, and the callback function is invoked in the chosen main context in the order of the events.
+ *
+ * @remarks With #NETWORK_INFO_DISPATCH_CALLER_CONTEXT, call g_main_context_push_thread_default() before this function to choose a main context other than the default one. \n
+ * The events which are already queued are delivered to the previous main context. \n
+ * After network_info_unsubscribe() returns, no queued event is delivered. See network_info_unsubscribe() for a callback function which is already running.
+ *
+ * @param [in] subscription The subscription handle
+ * @param [in] mode The dispatch mode
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Failed to start the dispatch thread
+ * @see network_info_subscribe()
+ *
+ */
+int network_info_subscription_set_dispatch_mode(network_info_subscription_h subscription, network_info_dispatch_mode_e mode);
+
+/**
+ * @brief Gets the runtime statistics of the library.
+ *
+ * @details The statistics are counted since the process started or network_info_reset_stats() was called.
+ *
+ * @remarks The counters are updated without any lock, so counters of a call in progress may not be consistent with each other.
+ *
+ * @param [out] stats The statistics
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see network_info_reset_stats()
+ *
+ */
+int network_info_get_stats(network_info_stats_s *stats);
+
+/**
+ * @brief Resets all counters of the runtime statistics to 0.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @see network_info_get_stats()
+ *
+ */
+int network_info_reset_stats();
+
+/**
+ * @brief Starts recording the changes of network information in the event history.
+ *
+ * @details The changes of service state, cell ID, LAC, RSSI and roaming state of the SIM slots which the store provides are recorded with their time
+ * in a buffer of fixed size, which keeps the latest changes. Recording a change never allocates memory or blocks.
+ * A value which is the same as the value of the same type and slot recorded last is not recorded again.
+ *
+ * @remarks Nothing is recorded until this function is called, because the changes are observed through key watches
+ * which are kept only while the history is enabled. \n
+ * The changes are observed in the main loop, like the change callbacks. \n
+ * The first value of each type after this function is called is recorded, even if it was recorded before the history was disabled.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Internal error
+ * @see network_info_disable_history()
+ * @see network_info_get_recent_history()
+ * @see network_info_get_history_since()
+ *
+ */
+int network_info_enable_history();
+
+/**
+ * @brief Stops recording the changes of network information.
+ *
+ * @remarks The recorded changes are kept.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @see network_info_enable_history()
+ *
+ */
+int network_info_disable_history();
+
+/**
+ * @brief Copies the latest changes recorded in the event history.
+ *
+ * @param [out] entries The buffer which the changes are copied to, from the oldest to the newest
+ * @param [in] max_count The number of entries of @a entries
+ * @param [out] count The number of the copied changes
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see network_info_enable_history()
+ *
+ */
+int network_info_get_recent_history(network_info_history_entry_s *entries, int max_count, int *count);
+
+/**
+ * @brief Copies the changes recorded after the given sequence number.
+ *
+ * @details To read all changes without a gap, pass the sequence number of the last copied change to the next call.
+ *
+ * @param [in] sequence The sequence number of the last change already read, 0 to read from the oldest change
+ * @param [out] entries The buffer which the changes are copied to, from the oldest to the newest
+ * @param [in] max_count The number of entries of @a entries
+ * @param [out] count The number of the copied changes
+ * @param [out] lost_count The number of changes after @a sequence which were overwritten by newer changes before they were copied
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see network_info_enable_history()
+ *
+ */
+int network_info_get_history_since(unsigned long long sequence, network_info_history_entry_s *entries, int max_count, int *count, unsigned long long *lost_count);
 
 
 /**
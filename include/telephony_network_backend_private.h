@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __TIZEN_TELEPHONY_NETWORK_INFO_BACKEND_PRIVATE_H__
+#define __TIZEN_TELEPHONY_NETWORK_INFO_BACKEND_PRIVATE_H__
+
+#include <tizen.h>
+#include <telephony_network_type.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @file telephony_network_backend_private.h
+ * @brief This file contains the APIs to choose the store which the network information is read from, and to replay recorded changes into the in-memory store.
+ * @remarks This file is not installed. It is used by the tests built in the source tree.
+ */
+
+/**
+ * @addtogroup CAPI_TELEPHONY_NETWORK_INFO_MODULE
+ * @{
+ */
+
+/**
+ * @brief Enumeration for the stores which the network information is read from.
+ */
+typedef enum
+{
+	NETWORK_INFO_BACKEND_VCONF = 0x00,	/**< vconf, the default */
+	NETWORK_INFO_BACKEND_MEMORY,	/**< In-memory keys set by network_info_memory_backend_set_*() in the same process */
+} network_info_backend_e;
+
+/**
+ * @brief Chooses the store which the network information is read from.
+ *
+ * @remarks This function must be called before any key is watched, that is before the other network_info_*() functions are called.
+ *
+ * @param [in] backend The store
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED Keys are already watched
+ *
+ */
+int network_info_set_backend(network_info_backend_e backend);
+
+/**
+ * @brief Sets an integer key of the in-memory store.
+ *
+ * @details If #NETWORK_INFO_BACKEND_MEMORY is used, the change is notified before this function returns.
+ *
+ * @param [in] key The key, such as VCONFKEY_TELEPHONY_CELLID
+ * @param [in] value The value
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @see network_info_set_backend()
+ *
+ */
+int network_info_memory_backend_set_int(const char *key, int value);
+
+/**
+ * @brief Sets a boolean key of the in-memory store.
+ *
+ * @details If #NETWORK_INFO_BACKEND_MEMORY is used, the change is notified before this function returns.
+ *
+ * @param [in] key The key, such as VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL
+ * @param [in] value The value
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @see network_info_set_backend()
+ *
+ */
+int network_info_memory_backend_set_bool(const char *key, bool value);
+
+/**
+ * @brief Sets a string key of the in-memory store.
+ *
+ * @details If #NETWORK_INFO_BACKEND_MEMORY is used, the change is notified before this function returns.
+ *
+ * @param [in] key The key, such as VCONFKEY_TELEPHONY_NWNAME
+ * @param [in] value The value
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @see network_info_set_backend()
+ *
+ */
+int network_info_memory_backend_set_str(const char *key, const char *value);
+
+/**
+ * @brief Gets the number of reads made from the backend since the process started or the count was reset.
+ *
+ * @details A batch read of several keys is counted as one read. Reads served from the cache or the tracked service state are not counted.
+ *
+ * @param [out] count The number of reads
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see network_info_backend_reset_read_count()
+ *
+ */
+int network_info_backend_get_read_count(unsigned long long *count);
+
+/**
+ * @brief Resets the number of reads made from the backend to 0.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @see network_info_backend_get_read_count()
+ *
+ */
+int network_info_backend_reset_read_count();
+
+/**
+ * @brief Called when the replay started by network_info_start_replay() finishes.
+ * @param [in] result #NETWORK_INFO_ERROR_NONE if the whole log was replayed, #NETWORK_INFO_ERROR_OPERATION_FAILED if the log is broken or a change cannot be set
+ * @param [in] user_data The user data passed from network_info_start_replay()
+ * @see network_info_start_replay()
+ */
+typedef void(* network_info_replay_finished_cb)(int result, void *user_data);
+
+/**
+ * @brief Replays a log written by network_info_start_recording().
+ *
+ * @details The changes in the log are set to the keys of the in-memory store, and delivered through the same path as the changes notified by the backend,
+ * so the subscriptions and the cache see them as real changes, and the getters return the replayed values.
+ *
+ * @remarks The changes are delivered in the default main loop, at a lower priority than the deliveries they cause. \n
+ * The first change is delivered without waiting.
+ *
+ * @param [in] path The path of the log
+ * @param [in] speed How many times faster than recorded the log is replayed, 1 for the recorded speed, 0 for no wait between the changes
+ * @param [in] callback The callback function to be invoked when the replay finishes, or NULL
+ * @param [in] user_data The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED #NETWORK_INFO_BACKEND_MEMORY is not used, the log cannot be read, or a replay is already in progress
+ * @pre #NETWORK_INFO_BACKEND_MEMORY must be chosen with network_info_set_backend().
+ * @post network_info_replay_finished_cb() will be invoked.
+ * @see network_info_stop_replay()
+ *
+ */
+int network_info_start_replay(const char *path, unsigned int speed, network_info_replay_finished_cb callback, void *user_data);
+
+/**
+ * @brief Stops the replay in progress.
+ *
+ * @remarks network_info_replay_finished_cb() is not invoked for the stopped replay.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED No replay is in progress
+ * @see network_info_start_replay()
+ *
+ */
+int network_info_stop_replay();
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// __TIZEN_TELEPHONY_NETWORK_INFO_BACKEND_PRIVATE_H__
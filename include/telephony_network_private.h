@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __TIZEN_TELEPHONY_NETWORK_INFO_PRIVATE_H__
+#define __TIZEN_TELEPHONY_NETWORK_INFO_PRIVATE_H__
+
+#include <telephony_network.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct _telephony_key_info
+{
+	const char* key;
+	int type;	// VCONF_TYPE_INT, VCONF_TYPE_BOOL or VCONF_TYPE_STRING
+	size_t offset;	// offset of the value in telephony_key_values
+} telephony_key_info;
+
+// Value of a key delivered by the change notification of the backend
+typedef struct _telephony_key_value
+{
+	int type;	// VCONF_TYPE_INT, VCONF_TYPE_BOOL or VCONF_TYPE_STRING
+	int int_value;	// the value of VCONF_TYPE_INT and VCONF_TYPE_BOOL
+	const char* str_value;	// the value of VCONF_TYPE_STRING, owned by the backend
+} telephony_key_value;
+
+typedef void (*telephony_key_changed_cb)(const char* key, const telephony_key_value* value, void* user_data);
+
+// Key-value store which the network information is read from.
+// A backend reports the changes of the watched keys with _network_info_backend_key_changed().
+typedef struct _telephony_backend
+{
+	int (*get_int)(const char* key, int* value);
+	int (*get_bool)(const char* key, int* value);
+	char* (*get_str)(const char* key);	// the returned string must be released with free()
+	// Reads all keys at once. The value of a string key is copied with _network_info_copy_str() to a buffer of NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1 bytes.
+	int (*read_keys)(const telephony_key_info* keys, int count, void* values);
+	int (*watch_key)(const char* key);
+	int (*unwatch_key)(const char* key);
+} telephony_backend;
+
+// Held while subscriptions, watches and the cache are changed, and while the events are dispatched
+void _network_info_lock();
+void _network_info_unlock();
+
+// Keys of the slot 0, indexed by the key index of the recorded logs
+const telephony_key_info* _network_info_get_keys(int* count);
+
+int _network_info_backend_get_int(const char* key, int* value);
+int _network_info_backend_get_bool(const char* key, int* value);
+char* _network_info_backend_get_str(const char* key);
+int _network_info_backend_read_keys(const telephony_key_info* keys, int count, void* values);
+
+// Copies a string value to a buffer, filling the rest with 0. A value which does not fit is cut before the UTF-8 character which does not fit.
+void _network_info_copy_str(char* buffer, size_t buffer_size, const char* value);
+// Whether a string copied by _network_info_copy_str() may have been cut, that is it is long enough
+bool _network_info_str_may_be_cut(const char* buffer, size_t buffer_size);
+
+// One backend watch of a key is shared by all callbacks of the key. A callback is identified by key, callback and user_data.
+int _network_info_backend_notify_key_changed(const char* key, telephony_key_changed_cb callback, void* user_data);
+// Same as _network_info_backend_notify_key_changed(), but the callback is notified before the other callbacks of the key
+int _network_info_backend_notify_key_changed_first(const char* key, telephony_key_changed_cb callback, void* user_data);
+int _network_info_backend_ignore_key_changed(const char* key, telephony_key_changed_cb callback, void* user_data);
+void _network_info_backend_key_changed(const char* key, const telephony_key_value* value);
+// Whether the in-memory store is the backend
+bool _network_info_backend_is_memory();
+// Sets a recorded change to the in-memory store, which delivers it. Fails if the in-memory store is not the backend.
+int _network_info_backend_replay_key_changed(const char* key, const telephony_key_value* value);
+
+// Runtime statistics. A call is measured by passing the result of _network_info_stats_begin() to the end function.
+unsigned long long _network_info_stats_begin();
+int _network_info_stats_end(network_info_api_e api, unsigned long long begin, int ret);
+void _network_info_stats_callback_end(unsigned long long begin);
+void _network_info_stats_delivery(unsigned long long dispatch_time);
+void _network_info_stats_notification();
+void _network_info_stats_suppressed();
+
+// Records a change of a SIM slot in the event history. Must be called with _network_info_lock() held.
+void _network_info_history_add(int slot_index, network_info_history_type_e type, int value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// __TIZEN_TELEPHONY_NETWORK_INFO_PRIVATE_H__
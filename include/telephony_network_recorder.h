@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __TIZEN_TELEPHONY_NETWORK_INFO_RECORDER_H__
+#define __TIZEN_TELEPHONY_NETWORK_INFO_RECORDER_H__
+
+#include <tizen.h>
+#include <telephony_network_type.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @file telephony_network_recorder.h
+ * @brief This file contains the APIs to record the key changes seen by the library.
+ * @remarks The recorded changes are replayed with the in-memory backend by the tests built in the source tree.
+ */
+
+/**
+ * @addtogroup CAPI_TELEPHONY_NETWORK_INFO_MODULE
+ * @{
+ */
+
+/**
+ * @brief Starts recording the changes of the keys which the network information is read from.
+ *
+ * @details The changes of the service type, circuit service, flight mode, cell ID, LAC, RSSI, roaming state, PLMN and provider name
+ * are appended to @a path in a compact binary log, together with the time between them.
+ * If @a path already contains a log, the new changes are appended to it.
+ *
+ * @remarks The recording stops when a change cannot be written, such as when the disk is full, so that the log never misses a change in the middle.
+ *
+ * @param [in] path The path of the log
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED The log cannot be opened, or the recording is already started
+ * @see network_info_stop_recording()
+ *
+ */
+int network_info_start_recording(const char *path);
+
+/**
+ * @brief Stops recording the changes of the keys and closes the log.
+ *
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #NETWORK_INFO_ERROR_NONE Successful
+ * @retval #NETWORK_INFO_ERROR_OPERATION_FAILED The recording is not started, or was stopped by a failed write
+ * @see network_info_start_recording()
+ *
+ */
+int network_info_stop_recording();
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// __TIZEN_TELEPHONY_NETWORK_INFO_RECORDER_H__
@@ -42,6 +42,7 @@ typedef enum
 	NETWORK_INFO_ERROR_NONE = TIZEN_ERROR_NONE,	/**< Successful */
 	NETWORK_INFO_ERROR_OUT_OF_MEMORY = TIZEN_ERROR_OUT_OF_MEMORY, /**< Out of memory */
 	NETWORK_INFO_ERROR_INVALID_PARAMETER = TIZEN_ERROR_INVALID_PARAMETER, /**< Invalid parameter */	
+	NETWORK_INFO_ERROR_NOT_SUPPORTED = TIZEN_ERROR_NOT_SUPPORTED, /**< Not supported */
 	NETWORK_INFO_ERROR_OPERATION_FAILED = TIZEN_ERROR_TELEPHONY_CLASS | 0x2000, /**< Operation failed */	
 	NETWORK_INFO_ERROR_OUT_OF_SERVICE = TIZEN_ERROR_TELEPHONY_CLASS | 0x2001, /**< Out of service */		
 } network_info_error_e;
@@ -89,6 +90,235 @@ typedef enum
 } network_info_service_state_e;
 
 
+/**
+ * @brief The structure type containing the PLMN (Public Land Mobile Network) of current network.
+ * @see network_info_get_plmn()
+ */
+typedef struct
+{
+	int mcc;	/**< The Mobile Country Code */
+	int mnc;	/**< The Mobile Network Code */
+	int mnc_length;	/**< The number of digits of the Mobile Network Code, 2 or 3 */
+	char mcc_str[4];	/**< The Mobile Country Code as a null-terminated string of three digits */
+	char mnc_str[4];	/**< The Mobile Network Code as a null-terminated string of @a mnc_length digits */
+} network_info_plmn_s;
+
+
+/**
+ * @brief The maximum length of the network provider name in #network_info_snapshot_s.
+ */
+#define NETWORK_INFO_PROVIDER_NAME_LEN_MAX 64
+
+
+/**
+ * @brief The structure type containing all network information at one point in time.
+ * @see network_info_get_snapshot()
+ */
+typedef struct
+{
+	network_info_service_state_e service_state;	/**< The network state of call service */
+	network_info_type_e network_type;	/**< The network type of telephony */
+	int lac;	/**< The Location Area Code */
+	int cell_id;	/**< The cell identification number */
+	network_info_rssi_e rssi;	/**< The Received Signal Strength Indicator */
+	bool is_roaming;	/**< The roaming state */
+	char mcc[4];	/**< The Mobile Country Code */
+	char mnc[4];	/**< The Mobile Network Code */
+	char provider_name[NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1];	/**< The name of the network provider, cut before the UTF-8 character which does not fit. network_info_get_provider_name() gets the full name. */
+} network_info_snapshot_s;
+
+
+/**
+ * @brief The structure type containing the identity of the serving cell.
+ * @details All fields are read in one request. See network_info_get_serving_cell() for a change made during the read.
+ * #NETWORK_INFO_EVENT_SERVING_CELL is delivered once for the changes made in the same main loop iteration, such as a handover.
+ * A change made out of service is delivered when the service returns.
+ * @see network_info_get_serving_cell()
+ */
+typedef struct
+{
+	network_info_plmn_s plmn;	/**< The PLMN */
+	int lac;	/**< The Location Area Code */
+	int cell_id;	/**< The cell identification number */
+} network_info_serving_cell_s;
+
+
+/**
+ * @brief Enumeration for the events which can be subscribed.
+ * @see network_info_subscribe()
+ */
+typedef enum
+{
+	NETWORK_INFO_EVENT_SERVICE_STATE = 0x00,	/**< The service state changes. The data is #network_info_service_state_e */
+	NETWORK_INFO_EVENT_CELL_ID,	/**< The cell ID changes. The data is int */
+	NETWORK_INFO_EVENT_RSSI,	/**< The RSSI changes. The data is #network_info_rssi_e */
+	NETWORK_INFO_EVENT_ROAMING_STATE,	/**< The roaming state changes. The data is bool */
+	NETWORK_INFO_EVENT_NETWORK_CHANGED,	/**< Any network information changes. The data is #network_info_change_s */
+	NETWORK_INFO_EVENT_SERVING_CELL,	/**< The PLMN, LAC or cell ID of the serving cell changes. The data is #network_info_serving_cell_s */
+	NETWORK_INFO_EVENT_PROVIDER_NAME,	/**< The name of the network provider changes. The data is a null-terminated string (char) of at most #NETWORK_INFO_PROVIDER_NAME_LEN_MAX bytes, cut like in #network_info_snapshot_s */
+	NETWORK_INFO_EVENT_TYPE,	/**< The network type changes. The data is #network_info_type_e */
+	NETWORK_INFO_EVENT_PLMN,	/**< The PLMN changes. The data is #network_info_plmn_s */
+} network_info_event_e;
+
+
+/**
+ * @brief Enumeration for the fields of #network_info_snapshot_s.
+ * @see network_info_change_s
+ */
+typedef enum
+{
+	NETWORK_INFO_FIELD_SERVICE_STATE = 0x01,	/**< The service state */
+	NETWORK_INFO_FIELD_NETWORK_TYPE = 0x02,	/**< The network type */
+	NETWORK_INFO_FIELD_LAC = 0x04,	/**< The Location Area Code */
+	NETWORK_INFO_FIELD_CELL_ID = 0x08,	/**< The cell ID */
+	NETWORK_INFO_FIELD_RSSI = 0x10,	/**< The RSSI */
+	NETWORK_INFO_FIELD_ROAMING_STATE = 0x20,	/**< The roaming state */
+	NETWORK_INFO_FIELD_PLMN = 0x40,	/**< The MCC and MNC */
+	NETWORK_INFO_FIELD_PROVIDER_NAME = 0x80,	/**< The name of the network provider */
+} network_info_field_e;
+
+
+/**
+ * @brief The structure type containing the data of #NETWORK_INFO_EVENT_NETWORK_CHANGED.
+ * @details The changes made in the same main loop iteration are delivered together.
+ */
+typedef struct
+{
+	unsigned int changed_fields;	/**< The fields which differ from the previous delivery, a bitwise OR of #network_info_field_e */
+	network_info_snapshot_s snapshot;	/**< The current network information, filled in the same way as network_info_get_snapshot() */
+} network_info_change_s;
+
+
+/**
+ * @brief The subscription handle of an event.
+ * @see network_info_subscribe()
+ */
+typedef struct _network_info_subscription_s* network_info_subscription_h;
+
+
+/**
+ * @brief The handle of the network information of a SIM slot.
+ * @see network_info_create()
+ */
+typedef struct _network_info_s* network_info_h;
+
+
+/**
+ * @brief The structure type containing the delivery policy of RSSI subscription.
+ * @details A new level which differs from the last delivered level by @a min_delta or more is delivered without waiting.
+ * A smaller change is delivered when it has been kept for @a hold_time, or, if @a hold_time is 0, only when a later level differs by @a min_delta or more.
+ * Two deliveries are at least @a min_interval apart. The last level which passes these conditions is always delivered in the end.
+ * @see network_info_subscription_set_rssi_policy()
+ */
+typedef struct
+{
+	unsigned int min_interval;	/**< The minimum interval between two deliveries in milliseconds, 0 for no limit */
+	unsigned int hold_time;	/**< The time in milliseconds a change smaller than @a min_delta must be kept before it is delivered, 0 to never deliver it by time (or to deliver every change at once if @a min_delta is 0) */
+	int min_delta;	/**< The change of level which is delivered without waiting, 0 to make every change wait for @a hold_time */
+} network_info_rssi_policy_s;
+
+
+/**
+ * @brief Enumeration for the ways the callback function of a subscription is invoked.
+ * @see network_info_subscription_set_dispatch_mode()
+ */
+typedef enum
+{
+	NETWORK_INFO_DISPATCH_INLINE = 0x00,	/**< Invoked in the key change notification, before the notification returns, with the lock of the library held */
+	NETWORK_INFO_DISPATCH_CALLER_CONTEXT,	/**< Queued to the thread-default main context of the thread which sets the mode */
+	NETWORK_INFO_DISPATCH_THREAD,	/**< Queued to the dispatch thread owned by the library */
+} network_info_dispatch_mode_e;
+
+
+/**
+ * @brief Enumeration for the APIs counted by network_info_get_stats().
+ */
+typedef enum
+{
+	NETWORK_INFO_API_GET_LAC = 0x00,	/**< network_info_get_lac() */
+	NETWORK_INFO_API_GET_CELL_ID,	/**< network_info_get_cell_id() */
+	NETWORK_INFO_API_GET_RSSI,	/**< network_info_get_rssi() */
+	NETWORK_INFO_API_IS_ROAMING,	/**< network_info_is_roaming() */
+	NETWORK_INFO_API_GET_MCC,	/**< network_info_get_mcc() */
+	NETWORK_INFO_API_GET_MNC,	/**< network_info_get_mnc() */
+	NETWORK_INFO_API_GET_PLMN,	/**< network_info_get_plmn() */
+	NETWORK_INFO_API_GET_PROVIDER_NAME,	/**< network_info_get_provider_name() */
+	NETWORK_INFO_API_GET_TYPE,	/**< network_info_get_type() */
+	NETWORK_INFO_API_GET_SERVICE_STATE,	/**< network_info_get_service_state() */
+	NETWORK_INFO_API_GET_SNAPSHOT,	/**< network_info_get_snapshot() */
+	NETWORK_INFO_API_GET_SERVING_CELL,	/**< network_info_get_serving_cell() */
+	NETWORK_INFO_API_COPY_PROVIDER_NAME,	/**< network_info_copy_provider_name() */
+	NETWORK_INFO_API_COUNT	/**< The number of the APIs */
+} network_info_api_e;
+
+
+/**
+ * @brief The number of buckets of a latency histogram.
+ * @details Bucket @a i counts the latencies from 2^i to 2^(i+1) - 1 nanoseconds. The last bucket also counts all longer latencies.
+ */
+#define NETWORK_INFO_STATS_LATENCY_BUCKET_COUNT 32
+
+
+/**
+ * @brief The structure type containing the statistics of an API.
+ * @see network_info_stats_s
+ */
+typedef struct
+{
+	unsigned long long call_count;	/**< The number of calls */
+	unsigned long long out_of_memory_count;	/**< The number of calls which failed with #NETWORK_INFO_ERROR_OUT_OF_MEMORY */
+	unsigned long long invalid_parameter_count;	/**< The number of calls which failed with #NETWORK_INFO_ERROR_INVALID_PARAMETER */
+	unsigned long long operation_failed_count;	/**< The number of calls which failed with #NETWORK_INFO_ERROR_OPERATION_FAILED */
+	unsigned long long out_of_service_count;	/**< The number of calls which failed with #NETWORK_INFO_ERROR_OUT_OF_SERVICE */
+	unsigned long long latency[NETWORK_INFO_STATS_LATENCY_BUCKET_COUNT];	/**< The histogram of the time taken by a call */
+} network_info_api_stats_s;
+
+
+/**
+ * @brief The structure type containing the runtime statistics of the library.
+ * @see network_info_get_stats()
+ */
+typedef struct
+{
+	network_info_api_stats_s apis[NETWORK_INFO_API_COUNT];	/**< The statistics of each API, indexed by #network_info_api_e */
+	unsigned long long backend_read_count;	/**< The number of reads made from the backend */
+	unsigned long long notification_count;	/**< The number of key change notifications received */
+	unsigned long long suppressed_count;	/**< The number of events which were not delivered because the value did not change */
+	unsigned long long callback_count;	/**< The number of callback functions invoked */
+	unsigned long long callback_latency[NETWORK_INFO_STATS_LATENCY_BUCKET_COUNT];	/**< The histogram of the time taken by a callback function */
+	unsigned long long delivery_latency[NETWORK_INFO_STATS_LATENCY_BUCKET_COUNT];	/**< The histogram of the time from the dispatch of an event to the invocation of its callback function, including the time the event waits for its main context */
+} network_info_stats_s;
+
+
+/**
+ * @brief Enumeration for the changes recorded in the event history.
+ * @see network_info_history_entry_s
+ */
+typedef enum
+{
+	NETWORK_INFO_HISTORY_SERVICE_STATE = 0x00,	/**< The service state changes. The value is #network_info_service_state_e */
+	NETWORK_INFO_HISTORY_CELL_ID,	/**< The cell ID changes */
+	NETWORK_INFO_HISTORY_LAC,	/**< The Location Area Code changes */
+	NETWORK_INFO_HISTORY_RSSI,	/**< The RSSI changes. The value is #network_info_rssi_e */
+	NETWORK_INFO_HISTORY_ROAMING_STATE,	/**< The roaming state changes. The value is 1 if roaming, otherwise 0 */
+} network_info_history_type_e;
+
+
+/**
+ * @brief The structure type containing a change recorded in the event history.
+ * @see network_info_get_recent_history()
+ * @see network_info_get_history_since()
+ */
+typedef struct
+{
+	unsigned long long sequence;	/**< The sequence number of the change, starting from 1 */
+	long long timestamp;	/**< The monotonic time of the change in microseconds */
+	int slot;	/**< The SIM slot of the change, see network_info_create() */
+	network_info_history_type_e type;	/**< The type of the change */
+	int value;	/**< The new value */
+} network_info_history_entry_s;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,11 +16,13 @@
 
 
 #include <telephony_network.h>
+#include <telephony_network_private.h>
 #include <vconf-keys.h>
 #include <vconf.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stddef.h>
 #include <glib.h>
 #include <dlog.h>
 
@@ -29,34 +31,410 @@
 #endif
 #define LOG_TAG "TIZEN_N_NETWORK_INFO"
 
-// whether vconf_notify_key_changed is registered or not  
-static bool flight_mode_is_registered = false;
-static bool svctype_is_registered = false;
-static bool svc_cs_is_registered = false;
-static bool cell_id_is_registered = false;
-static bool rssi_is_registered = false;
-static bool roaming_is_registered = false;
+#define NETWORK_INFO_EVENT_COUNT (NETWORK_INFO_EVENT_PLMN + 1)
+#define NETWORK_INFO_HISTORY_TYPE_COUNT (NETWORK_INFO_HISTORY_ROAMING_STATE + 1)
+#define NETWORK_INFO_SLOT_COUNT 2
 
-typedef struct _telephony_cb_data
+typedef struct _telephony_rssi_filter
+{
+	network_info_rssi_policy_s policy;
+	int delivered_value;
+	gint64 delivered_time;
+	int pending_value;
+	gint64 pending_since;	// when pending_value was notified first
+	guint timer_id;
+} telephony_rssi_filter;
+
+struct _network_info_subscription_s
+{
+	network_info_h handle;
+	network_info_event_e event;
+	network_info_event_cb callback;
+	void* user_data;
+	GList link;	// link in telephony_event_data.subscriptions
+	bool is_removed;
+	telephony_rssi_filter* rssi_filter;	// NULL if every change is delivered at once
+	int ref_count;	// held by the subscription list, the timer of rssi_filter and the scheduled delivery
+	GMainContext* context;	// NULL if the callback is invoked inline
+	GQueue queued_events;	// telephony_queued_event waiting for the delivery in context
+	bool delivery_is_scheduled;
+	GThread* delivering_thread;	// thread invoking the queued callback, changed with delivery_lock held
+	unsigned int rssi_thresholds;	// bit t is set for the threshold t, 0 if every change is delivered
+};
+
+// Data of the events, copied when the delivery is queued
+typedef union _telephony_event_value
+{
+	network_info_service_state_e service_state;
+	int cell_id;
+	network_info_rssi_e rssi;
+	bool is_roaming;
+	network_info_change_s change;
+	network_info_serving_cell_s serving_cell;
+	char provider_name[NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1];
+} telephony_event_value;
+
+typedef struct _telephony_queued_event
+{
+	network_info_event_e event;
+	unsigned long long dispatch_time;	// see _network_info_stats_delivery()
+	telephony_event_value value;
+} telephony_queued_event;
+
+// Main context of the dispatch thread, created when NETWORK_INFO_DISPATCH_THREAD is set first
+static GMainContext* dispatch_context = NULL;
+
+// Lets network_info_unsubscribe() wait for the queued callback running in another thread.
+// No other lock is taken while delivery_lock is held.
+static GMutex delivery_lock;
+static GCond delivery_cond;
+
+// The number of dispatches in progress in all slots, changed with network_info_lock held.
+// The inline callbacks are invoked while it is not 0.
+static int dispatch_depth = 0;
+
+typedef struct _telephony_event_data
 {
 	int previous_value;
+	int subscriber_count;	// the number of subscriptions which are not removed
+	int dispatch_depth;
+	bool has_removed;	// whether subscriptions are removed during the dispatch
+	GQueue subscriptions;
+} telephony_event_data;
+
+// Value of each event before the first change, indexed by network_info_event_e
+static const int initial_event_values[NETWORK_INFO_EVENT_COUNT] =
+{
+	NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE,
+	0,
+	NETWORK_INFO_RSSI_0,
+	false,
+	0,
+	0,
+	0,
+	NETWORK_INFO_TYPE_UNKNOWN,
+	0
+};
+
+typedef struct _telephony_cb_data
+{
 	const void* cb;
 	void* user_data;
+	network_info_subscription_h subscription;
 } telephony_cb_data;
 
-// Callback function data
-static telephony_cb_data service_state_cb = {NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE, NULL, NULL};
-static telephony_cb_data cell_id_cb = {0, NULL, NULL};
-static telephony_cb_data rssi_cb = {NETWORK_INFO_RSSI_0, NULL, NULL};
-static telephony_cb_data roaming_cb = {false, NULL, NULL};
+typedef struct _telephony_key_values
+{
+	int service_type;
+	int cs_status;
+	int is_flight_mode;
+	int lac;
+	int cell_id;
+	int rssi;
+	int roaming_state;
+	int plmn;
+	char provider_name[NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1];
+} telephony_key_values;
+
+// Also the key index of the logs of network_info_start_recording(), so new keys must be added at the end
+typedef enum
+{
+	NETWORK_INFO_KEY_SVCTYPE = 0x00,
+	NETWORK_INFO_KEY_SVC_CS,
+	NETWORK_INFO_KEY_FLIGHT_MODE,
+	NETWORK_INFO_KEY_LAC,
+	NETWORK_INFO_KEY_CELL_ID,
+	NETWORK_INFO_KEY_RSSI,
+	NETWORK_INFO_KEY_ROAMING,
+	NETWORK_INFO_KEY_PLMN,
+	NETWORK_INFO_KEY_NWNAME,
+	NETWORK_INFO_KEY_COUNT
+} telephony_key_e;
+
+// Keys exposed by this library for the slot 0, indexed by telephony_key_e.
+// The other slots take the same type and value offset under the names of slot_key_names.
+static const telephony_key_info key_info[NETWORK_INFO_KEY_COUNT] =
+{
+	{VCONFKEY_TELEPHONY_SVCTYPE, VCONF_TYPE_INT, offsetof(telephony_key_values, service_type)},
+	{VCONFKEY_TELEPHONY_SVC_CS, VCONF_TYPE_INT, offsetof(telephony_key_values, cs_status)},
+	{VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, VCONF_TYPE_BOOL, offsetof(telephony_key_values, is_flight_mode)},
+	{VCONFKEY_TELEPHONY_LAC, VCONF_TYPE_INT, offsetof(telephony_key_values, lac)},
+	{VCONFKEY_TELEPHONY_CELLID, VCONF_TYPE_INT, offsetof(telephony_key_values, cell_id)},
+	{VCONFKEY_TELEPHONY_RSSI, VCONF_TYPE_INT, offsetof(telephony_key_values, rssi)},
+	{VCONFKEY_TELEPHONY_SVC_ROAM, VCONF_TYPE_INT, offsetof(telephony_key_values, roaming_state)},
+	{VCONFKEY_TELEPHONY_PLMN, VCONF_TYPE_INT, offsetof(telephony_key_values, plmn)},
+	{VCONFKEY_TELEPHONY_NWNAME, VCONF_TYPE_STRING, offsetof(telephony_key_values, provider_name)}
+};
+
+// Key names of each slot, indexed by telephony_key_e. The flight mode is shared by all slots.
+// vconf has no keys of the second SIM, so the names of the slot 1 are set only in the in-memory store, see __slot_is_supported().
+static const char* const slot_key_names[NETWORK_INFO_SLOT_COUNT][NETWORK_INFO_KEY_COUNT] =
+{
+	{
+		VCONFKEY_TELEPHONY_SVCTYPE,
+		VCONFKEY_TELEPHONY_SVC_CS,
+		VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL,
+		VCONFKEY_TELEPHONY_LAC,
+		VCONFKEY_TELEPHONY_CELLID,
+		VCONFKEY_TELEPHONY_RSSI,
+		VCONFKEY_TELEPHONY_SVC_ROAM,
+		VCONFKEY_TELEPHONY_PLMN,
+		VCONFKEY_TELEPHONY_NWNAME
+	},
+	{
+		"memory/telephony/svctype2",
+		"memory/telephony/svc_cs2",
+		VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL,
+		"memory/telephony/lac2",
+		"memory/telephony/cellid2",
+		"memory/telephony/rssi2",
+		"memory/telephony/svc_roam2",
+		"memory/telephony/plmn2",
+		"memory/telephony/nwname2"
+	}
+};
+
+typedef enum
+{
+	NETWORK_INFO_WATCH_SERVICE_STATE = 0x00,
+	NETWORK_INFO_WATCH_PROVIDER_NAME,
+	NETWORK_INFO_WATCH_CELL_ID,
+	NETWORK_INFO_WATCH_RSSI,
+	NETWORK_INFO_WATCH_ROAMING_STATE,
+	NETWORK_INFO_WATCH_NETWORK_CHANGED,
+	NETWORK_INFO_WATCH_SERVING_CELL,
+	NETWORK_INFO_WATCH_CACHE,
+	NETWORK_INFO_WATCH_HISTORY,
+	NETWORK_INFO_WATCH_PLMN,
+	NETWORK_INFO_WATCH_COUNT
+} telephony_watch_e;
+
+// Keys notified to an adapter. The adapter is called with the telephony_slot_key of the changed key.
+typedef struct _telephony_watch
+{
+	telephony_key_changed_cb adapter;
+	unsigned int keys;	// bit k is set for telephony_key_e k
+	bool is_notified_first;	// whether the adapter is notified before the other adapters of the key
+} telephony_watch;
+
+// Values read by the getters.
+// They are written with network_info_lock held and read without any lock by __read_state(),
+// so that getters in several threads never block each other or the notification.
+typedef struct _telephony_state
+{
+	bool service_state_is_tracked;
+	network_info_service_state_e service_state;
+	bool cache_is_valid;
+	telephony_key_values cache_values;
+	bool provider_name_is_tracked;
+	unsigned int provider_name_generation;	// increased whenever provider_name changes
+	char provider_name[NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1];
+} telephony_state;
+
+// See _network_info_lock()
+static GRecMutex network_info_lock;
+
+struct _telephony_slot;
+
+// Key of a slot, given to the adapters as user_data
+typedef struct _telephony_slot_key
+{
+	telephony_key_info info;
+	struct _telephony_slot* slot;
+	telephony_key_e key;
+} telephony_slot_key;
+
+// Network information of a SIM slot, shared by all handles of the slot
+typedef struct _telephony_slot
+{
+	int index;
+	telephony_slot_key keys[NETWORK_INFO_KEY_COUNT];	// indexed by telephony_key_e
+	telephony_state state;
+	unsigned int state_sequence;	// odd while state is being updated
+	int watch_ref_counts[NETWORK_INFO_WATCH_COUNT];	// the number of users of each watch, changed with network_info_lock held
+	// Service state maintained by __telephony_service_changed_cb_adapter while the service state watch has users.
+	// Only service_type, cs_status and is_flight_mode of service_state_values are used.
+	telephony_key_values service_state_values;
+	// Values watched for NETWORK_INFO_EVENT_NETWORK_CHANGED and NETWORK_INFO_EVENT_SERVING_CELL
+	guint network_changed_idle_id;
+	telephony_key_values network_values;
+	guint serving_cell_idle_id;
+	telephony_key_values serving_cell_values;
+	// Values recorded last in the event history, indexed by network_info_history_type_e, so that a value which did not change is not recorded again
+	int history_values[NETWORK_INFO_HISTORY_TYPE_COUNT];
+	bool history_value_is_known[NETWORK_INFO_HISTORY_TYPE_COUNT];
+	GQueue handles;	// network_info_h of the slot
+	int dispatch_depth;
+	bool has_destroyed;	// whether handles are destroyed during the dispatch
+} telephony_slot;
+
+static telephony_slot slots[NETWORK_INFO_SLOT_COUNT];
+static gsize slots_are_initialized = 0;
+
+// Handle of network_info_create(). The functions without handle use default_handle of the slot 0.
+struct _network_info_s
+{
+	telephony_slot* slot;
+	GList link;	// link in telephony_slot.handles
+	bool is_destroyed;
+	bool cache_is_enabled;	// read without any lock by the getters
+	telephony_event_data event_data[NETWORK_INFO_EVENT_COUNT];	// subscriptions of each event
+	telephony_cb_data legacy_cb_data[NETWORK_INFO_EVENT_COUNT];	// callback function data of network_info_set_*_changed_cb()
+	network_info_snapshot_s network_snapshot;	// the snapshot delivered last
+	network_info_serving_cell_s serving_cell;	// the serving cell delivered last
+};
+
+static struct _network_info_s default_handle;
+
+typedef struct _telephony_history_key
+{
+	telephony_key_e key;
+	network_info_history_type_e type;
+} telephony_history_key;
+
+// Keys recorded in the event history besides the service state
+static const telephony_history_key history_keys[] =
+{
+	{NETWORK_INFO_KEY_CELL_ID, NETWORK_INFO_HISTORY_CELL_ID},
+	{NETWORK_INFO_KEY_LAC, NETWORK_INFO_HISTORY_LAC},
+	{NETWORK_INFO_KEY_RSSI, NETWORK_INFO_HISTORY_RSSI},
+	{NETWORK_INFO_KEY_ROAMING, NETWORK_INFO_HISTORY_ROAMING_STATE}
+};
+
+static bool history_is_enabled = false;
+
+// Request of network_info_get_*_async(), which is completed on the main context of the caller
+typedef struct _telephony_async_request
+{
+	network_info_api_e api;	// NETWORK_INFO_API_GET_SNAPSHOT or NETWORK_INFO_API_GET_SERVING_CELL
+	telephony_slot* slot;
+	bool use_cache;
+	void* callback;
+	void* user_data;
+	GMainContext* context;
+	int result;
+	telephony_key_values values;
+} telephony_async_request;
+
+// Requests which wait for the read in progress
+static GQueue async_requests = G_QUEUE_INIT;
+static bool async_read_is_running = false;
+
+static int __get_lac(network_info_h handle, int* lac);
+static int __get_cell_id(network_info_h handle, int* cell_id);
+static int __get_rssi(network_info_h handle, network_info_rssi_e* rssi);
+static int __is_roaming(network_info_h handle, bool* is_roaming);
+static int __get_mcc(network_info_h handle, char** mcc);
+static int __get_mnc(network_info_h handle, char** mnc);
+static int __get_plmn(network_info_h handle, network_info_plmn_s* plmn);
+static int __get_plmn_value(network_info_h handle, int* plmn_int);
+static int __get_provider_name(network_info_h handle, char** provider_name);
+static int __copy_provider_name(network_info_h handle, char* buffer, int buffer_size, unsigned int* generation);
+static int __get_type(network_info_h handle, network_info_type_e* network_type);
+static int __get_service_state(network_info_h handle, network_info_service_state_e* network_service_state);
+static int __get_snapshot(network_info_h handle, network_info_snapshot_s* snapshot);
+static int __get_serving_cell(network_info_h handle, network_info_serving_cell_s* serving_cell);
 
 // Callback function adapter
-static void __telephony_service_changed_cb_adapter(keynode_t *node, void* user_data);
-static void __cell_id_changed_cb_adapter(keynode_t *node, void* user_data);
-static void __rssi_changed_cb_adapter(keynode_t *node, void* user_data);
-static void __roaming_changed_cb_adapter(keynode_t *node, void* user_data);
+static void __telephony_service_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __cell_id_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __rssi_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __roaming_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __provider_name_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __plmn_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __cache_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __network_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static void __history_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static gboolean __network_changed_idle_cb(gpointer user_data);
+static void __serving_cell_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data);
+static gboolean __serving_cell_idle_cb(gpointer user_data);
+static void __convert_to_serving_cell(const telephony_key_values* values, network_info_serving_cell_s* serving_cell);
+static int __request_async(network_info_h handle, network_info_api_e api, void* callback, void* user_data);
+static gpointer __async_read_thread_func(gpointer data);
+static gboolean __async_request_cb(gpointer user_data);
+static void __free_async_request(gpointer data);
+static void __legacy_cb_adapter(network_info_event_e event, void* data, void* user_data);
 static char* __convert_error_code_to_string(network_info_error_e error_code);
-static int __check_service_state(char* function_name);
+static int __check_service_state(char* function_name, telephony_slot* slot, telephony_state* current);
+static bool __get_watched_service_state(const telephony_state* current, network_info_service_state_e* service_state);
+static int __start_provider_name_tracking(telephony_slot* slot);
+static int __stop_provider_name_tracking(telephony_slot* slot);
+static void __update_provider_name(telephony_slot* slot, const char* provider_name);
+static int __register_history_watch(telephony_slot* slot);
+static void __unregister_history_watch(telephony_slot* slot);
+static void __add_history(telephony_slot* slot, network_info_history_type_e type, int value);
+static int __register_service_state_watch(telephony_slot* slot);
+static int __unregister_service_state_watch(telephony_slot* slot);
+static int __register_gated_watch(telephony_slot* slot, telephony_watch_e watch);
+static int __unregister_gated_watch(telephony_slot* slot, telephony_watch_e watch);
+static network_info_type_e __convert_service_type_to_network_type(int service_type);
+static network_info_service_state_e __convert_to_service_state(int service_type, int cs_status, int is_flight_mode);
+static void __convert_to_plmn(int plmn_int, network_info_plmn_s* plmn);
+static int __read_key_values(telephony_slot* slot, telephony_key_values* values);
+static int __read_keys(telephony_slot* slot, unsigned int keys, telephony_key_values* values);
+static int __get_key_values(char* function_name, network_info_h handle, unsigned int keys, telephony_key_values* values);
+static bool __cache_is_usable(network_info_h handle, const telephony_state* current);
+static void __update_key_value(telephony_key_values* values, const telephony_key_info* info, const telephony_key_value* value);
+static void __read_state(telephony_slot* slot, telephony_state* current);
+static void __begin_state_update(telephony_slot* slot);
+static void __end_state_update(telephony_slot* slot);
+static void __init_slots();
+static bool __slot_is_supported(int index);
+static void __init_handle(network_info_h handle, telephony_slot* slot);
+static network_info_h __get_default_handle();
+static void __free_handle(network_info_h handle);
+static int __set_rssi_policy(network_info_subscription_h subscription, const network_info_rssi_policy_s* policy);
+static int __set_rssi_thresholds(network_info_subscription_h subscription, const network_info_rssi_e* thresholds, int count);
+static unsigned int __get_crossed_rssi_thresholds(int old_rssi, int new_rssi);
+static network_info_service_state_e __convert_to_snapshot(const telephony_key_values* values, network_info_snapshot_s* snapshot);
+static int __get_event_value(network_info_h handle, network_info_event_e event, int* value);
+static int __register_event_watch(network_info_h handle, network_info_event_e event);
+static int __unregister_event_watch(network_info_h handle, network_info_event_e event);
+static int __add_subscription(network_info_h handle, network_info_event_e event, network_info_event_cb callback, void* user_data, network_info_subscription_h* subscription);
+static int __remove_subscription(network_info_subscription_h subscription);
+static void __purge_subscriptions(telephony_event_data* event);
+static void __wait_for_delivery(network_info_subscription_h subscription);
+static network_info_subscription_h __ref_subscription(network_info_subscription_h subscription);
+static void __unref_subscription(network_info_subscription_h subscription);
+static void __deliver_event(network_info_subscription_h subscription, network_info_event_e event, void* data);
+static void __invoke_callback(network_info_subscription_h subscription, network_info_event_e event, void* data, unsigned long long dispatch_time);
+static size_t __get_event_data_size(network_info_event_e event);
+static gboolean __queued_event_cb(gpointer user_data);
+static GMainContext* __get_dispatch_context();
+static gpointer __dispatch_thread_func(gpointer data);
+static void __filter_rssi(network_info_subscription_h subscription, int rssi);
+static void __evaluate_rssi_filter(network_info_subscription_h subscription);
+static gboolean __rssi_filter_timeout_cb(gpointer user_data);
+static void __begin_dispatch(telephony_slot* slot);
+static void __end_dispatch(telephony_slot* slot);
+static void __dispatch_event(telephony_slot* slot, network_info_event_e event, int value, void* data);
+static void __notify_subscriptions(network_info_h handle, network_info_event_e event, int value, void* data, unsigned int crossed_rssi_thresholds);
+static unsigned int __compare_snapshot(const network_info_snapshot_s* old_snapshot, const network_info_snapshot_s* new_snapshot);
+static int __set_legacy_cb(network_info_h handle, network_info_event_e event, const void* callback, void* user_data);
+static int __unset_legacy_cb(network_info_h handle, network_info_event_e event);
+static int __ref_watch(telephony_slot* slot, telephony_watch_e watch);
+static int __unref_watch(telephony_slot* slot, telephony_watch_e watch);
+
+#define NETWORK_INFO_KEY_BIT(key) (1u << (key))
+#define NETWORK_INFO_ALL_KEYS (NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_COUNT) - 1)
+#define NETWORK_INFO_SERVICE_STATE_KEYS (NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_SVCTYPE) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_SVC_CS) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_FLIGHT_MODE))
+
+// Key watches, indexed by telephony_watch_e.
+// A watch of a slot is registered when its first user appears, and unregistered when its last user leaves.
+// The backend shares one watch of a key among all adapters, so a key is watched once however many watches contain it.
+static telephony_watch watches[NETWORK_INFO_WATCH_COUNT] =
+{
+	{__telephony_service_changed_cb_adapter, NETWORK_INFO_SERVICE_STATE_KEYS, false},
+	{__provider_name_changed_cb_adapter, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_NWNAME), false},
+	{__cell_id_changed_cb_adapter, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_CELL_ID), false},
+	{__rssi_changed_cb_adapter, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_RSSI), false},
+	{__roaming_changed_cb_adapter, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_ROAMING), false},
+	{__network_changed_cb_adapter, NETWORK_INFO_ALL_KEYS, false},
+	{__serving_cell_changed_cb_adapter, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_PLMN) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_LAC) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_CELL_ID), false},
+	{__cache_changed_cb_adapter, NETWORK_INFO_ALL_KEYS, true},
+	{__history_changed_cb_adapter, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_CELL_ID) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_LAC) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_RSSI) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_ROAMING), false},
+	{__plmn_changed_cb_adapter, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_PLMN), false}
+};
 
 // Internal Macros
 #define NETWORK_INFO_CHECK_INPUT_PARAMETER(arg) \
@@ -67,23 +445,146 @@ static int __check_service_state(char* function_name);
 	}
 	
 
+int network_info_create(int slot, network_info_h* handle)
+{
+	network_info_h handle_p = NULL;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	if( slot < 0 || slot >= NETWORK_INFO_SLOT_COUNT )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid slot(%d)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER, slot);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if( __slot_is_supported(slot) == false )
+	{
+		LOGE("[%s] NOT_SUPPORTED(0x%08x) : slot(%d) is provided only by the in-memory backend", __FUNCTION__, NETWORK_INFO_ERROR_NOT_SUPPORTED, slot);
+		return NETWORK_INFO_ERROR_NOT_SUPPORTED;
+	}
+
+	__init_slots();
+
+	handle_p = (network_info_h)calloc(1, sizeof(struct _network_info_s));
+	if( handle_p == NULL )
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+		return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	__init_handle(handle_p, &slots[slot]);
+
+	g_rec_mutex_lock(&network_info_lock);
+	g_queue_push_tail_link(&slots[slot].handles, &handle_p->link);
+	g_rec_mutex_unlock(&network_info_lock);
+
+	*handle = handle_p;
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_destroy(network_info_h handle)
+{
+	GList* link = NULL;
+	GList* next = NULL;
+	GList* removed_subscriptions = NULL;
+	network_info_subscription_h subscription = NULL;
+	bool is_waited = false;
+	int i = 0;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	if( handle == &default_handle )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : default handle", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( handle->is_destroyed == true )
+	{
+		g_rec_mutex_unlock(&network_info_lock);
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : already destroyed", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	// see network_info_unsubscribe()
+	is_waited = (dispatch_depth == 0);
+
+	for( i = 0; i < NETWORK_INFO_EVENT_COUNT; i++ )
+	{
+		__unset_legacy_cb(handle, i);
+
+		for( link = handle->event_data[i].subscriptions.head; link != NULL; link = next )
+		{
+			next = link->next;
+			subscription = (network_info_subscription_h)link->data;
+			if( subscription->is_removed == false )
+			{
+				removed_subscriptions = g_list_prepend(removed_subscriptions, __ref_subscription(subscription));
+				__remove_subscription(subscription);
+			}
+		}
+	}
+
+	network_info_handle_disable_cache(handle);
+
+	handle->is_destroyed = true;
+
+	// the handle is kept while dispatching, so that the dispatch can go on with the next handle
+	if( handle->slot->dispatch_depth > 0 )
+	{
+		handle->slot->has_destroyed = true;
+	}
+	else
+	{
+		__free_handle(handle);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	for( link = removed_subscriptions; link != NULL; link = link->next )
+	{
+		subscription = (network_info_subscription_h)link->data;
+		if( is_waited == true )
+		{
+			__wait_for_delivery(subscription);
+		}
+		__unref_subscription(subscription);
+	}
+	g_list_free(removed_subscriptions);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
 int network_info_get_lac(int* lac)
 {
+	return network_info_handle_get_lac(__get_default_handle(), lac);
+}
+
+int network_info_handle_get_lac(network_info_h handle, int* lac)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_LAC, begin, __get_lac(handle, lac));
+}
+
+static int __get_lac(network_info_h handle, int* lac)
+{
+	telephony_key_values values;
 	int ret = NETWORK_INFO_ERROR_NONE;
 
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
 	NETWORK_INFO_CHECK_INPUT_PARAMETER(lac);
 
-	ret = __check_service_state((char*)__FUNCTION__);
+	ret = __get_key_values((char*)__FUNCTION__, handle, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_LAC), &values);
 	if( ret != NETWORK_INFO_ERROR_NONE )
 	{
 		return ret;
 	}
 
-	if( vconf_get_int(VCONFKEY_TELEPHONY_LAC, lac) != 0 )
-	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
-	}
+	*lac = values.lac;
 
 	return NETWORK_INFO_ERROR_NONE;
 }
@@ -91,21 +592,31 @@ int network_info_get_lac(int* lac)
 
 int network_info_get_cell_id(int* cell_id)
 {
+	return network_info_handle_get_cell_id(__get_default_handle(), cell_id);
+}
+
+int network_info_handle_get_cell_id(network_info_h handle, int* cell_id)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_CELL_ID, begin, __get_cell_id(handle, cell_id));
+}
+
+static int __get_cell_id(network_info_h handle, int* cell_id)
+{
+	telephony_key_values values;
 	int ret = NETWORK_INFO_ERROR_NONE;
-	
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
 	NETWORK_INFO_CHECK_INPUT_PARAMETER(cell_id);
-	
-	ret = __check_service_state((char*)__FUNCTION__);
+
+	ret = __get_key_values((char*)__FUNCTION__, handle, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_CELL_ID), &values);
 	if( ret != NETWORK_INFO_ERROR_NONE )
 	{
 		return ret;
 	}
 
-	if( vconf_get_int(VCONFKEY_TELEPHONY_CELLID, cell_id) != 0 ) 
-	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
-	}
+	*cell_id = values.cell_id;
 
 	return NETWORK_INFO_ERROR_NONE;
 }
@@ -113,21 +624,31 @@ int network_info_get_cell_id(int* cell_id)
 
 int network_info_get_rssi(network_info_rssi_e* rssi)
 {
+	return network_info_handle_get_rssi(__get_default_handle(), rssi);
+}
+
+int network_info_handle_get_rssi(network_info_h handle, network_info_rssi_e* rssi)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_RSSI, begin, __get_rssi(handle, rssi));
+}
+
+static int __get_rssi(network_info_h handle, network_info_rssi_e* rssi)
+{
+	telephony_key_values values;
 	int ret = NETWORK_INFO_ERROR_NONE;
-	
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
 	NETWORK_INFO_CHECK_INPUT_PARAMETER(rssi);
-	
-	ret = __check_service_state((char*)__FUNCTION__);
+
+	ret = __get_key_values((char*)__FUNCTION__, handle, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_RSSI), &values);
 	if( ret != NETWORK_INFO_ERROR_NONE )
 	{
 		return ret;
 	}
 
-	if( vconf_get_int(VCONFKEY_TELEPHONY_RSSI, (int *)rssi) != 0 )
-	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
-	}
+	*rssi = values.rssi;
 
 	return NETWORK_INFO_ERROR_NONE;
 }
@@ -135,31 +656,38 @@ int network_info_get_rssi(network_info_rssi_e* rssi)
 
 int network_info_is_roaming(bool* is_roaming)
 {
-	int roaming_state = 0;
+	return network_info_handle_is_roaming(__get_default_handle(), is_roaming);
+}
+
+int network_info_handle_is_roaming(network_info_h handle, bool* is_roaming)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_IS_ROAMING, begin, __is_roaming(handle, is_roaming));
+}
+
+static int __is_roaming(network_info_h handle, bool* is_roaming)
+{
+	telephony_key_values values;
 	int ret = NETWORK_INFO_ERROR_NONE;
-	
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
 	NETWORK_INFO_CHECK_INPUT_PARAMETER(is_roaming);
-	
-	ret = __check_service_state((char*)__FUNCTION__);
+
+	ret = __get_key_values((char*)__FUNCTION__, handle, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_ROAMING), &values);
 	if( ret != NETWORK_INFO_ERROR_NONE )
 	{
 		return ret;
 	}
 
-	if( vconf_get_int(VCONFKEY_TELEPHONY_SVC_ROAM, &roaming_state) != 0 )
-	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
-	}
-
-	if( roaming_state == VCONFKEY_TELEPHONY_SVC_ROAM_ON )
+	if( values.roaming_state == VCONFKEY_TELEPHONY_SVC_ROAM_ON )
 	{
 		*is_roaming = true;
 	}
 	else
 	{
 		*is_roaming = false;
-	}			
+	}
 
 	return NETWORK_INFO_ERROR_NONE;
 }
@@ -167,34 +695,35 @@ int network_info_is_roaming(bool* is_roaming)
 
 int network_info_get_mcc(char** mcc)
 {
-	char plmn_str[32] = "";
-	int plmn_int = 0;
-	int mcc_length = 3;
+	return network_info_handle_get_mcc(__get_default_handle(), mcc);
+}
+
+int network_info_handle_get_mcc(network_info_h handle, char** mcc)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_MCC, begin, __get_mcc(handle, mcc));
+}
+
+static int __get_mcc(network_info_h handle, char** mcc)
+{
+	network_info_plmn_s plmn;
 	int ret = NETWORK_INFO_ERROR_NONE;	
 
 	NETWORK_INFO_CHECK_INPUT_PARAMETER(mcc);
-	
-	ret = __check_service_state((char*)__FUNCTION__);
+
+	ret = __get_plmn(handle, &plmn);
 	if( ret != NETWORK_INFO_ERROR_NONE )
 	{
 		return ret;
 	}
 
-	if( vconf_get_int(VCONFKEY_TELEPHONY_PLMN, &plmn_int) != 0 )
-	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
-	}
-
-	snprintf(plmn_str, 32, "%d", plmn_int);
-	*mcc = (char*)malloc(sizeof(char) * (mcc_length+1));
+	*mcc = strdup(plmn.mcc_str);
 	if( *mcc == NULL )
 	{
 		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
 		return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
 	}
-	memset(*mcc, 0x00, mcc_length+1);
-	strncpy(*mcc, plmn_str, mcc_length);
 
 	return NETWORK_INFO_ERROR_NONE;
 }
@@ -202,34 +731,84 @@ int network_info_get_mcc(char** mcc)
 
 int network_info_get_mnc(char** mnc)
 {
-	char plmn_str[32] = "";
-	int plmn_int = 0;
-	int mnc_length = 3; //mcc_length can 2 or 3 depending on a network, so have to proper way to get the exact length of mcc
+	return network_info_handle_get_mnc(__get_default_handle(), mnc);
+}
+
+int network_info_handle_get_mnc(network_info_h handle, char** mnc)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_MNC, begin, __get_mnc(handle, mnc));
+}
+
+static int __get_mnc(network_info_h handle, char** mnc)
+{
+	network_info_plmn_s plmn;
 	int ret = NETWORK_INFO_ERROR_NONE;
 	
 	NETWORK_INFO_CHECK_INPUT_PARAMETER(mnc);
-	
-	ret = __check_service_state((char*)__FUNCTION__);
+
+	ret = __get_plmn(handle, &plmn);
 	if( ret != NETWORK_INFO_ERROR_NONE )
 	{
 		return ret;
 	}
 
-	if( vconf_get_int(VCONFKEY_TELEPHONY_PLMN, &plmn_int) != 0 )
-	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
-	}
-
-	snprintf(plmn_str, 32, "%d", plmn_int);
-	*mnc = (char*)malloc(sizeof(char) * (mnc_length+1));
+	*mnc = strdup(plmn.mnc_str);
 	if( *mnc == NULL )
 	{
 		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
 		return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
 	}
-	memset(*mnc, 0x00, mnc_length+1);                
-	strncpy(*mnc, plmn_str+3, mnc_length);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+
+int network_info_get_plmn(network_info_plmn_s* plmn)
+{
+	return network_info_handle_get_plmn(__get_default_handle(), plmn);
+}
+
+int network_info_handle_get_plmn(network_info_h handle, network_info_plmn_s* plmn)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_PLMN, begin, __get_plmn(handle, plmn));
+}
+
+static int __get_plmn(network_info_h handle, network_info_plmn_s* plmn)
+{
+	int plmn_int = 0;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(plmn);
+
+	ret = __get_plmn_value(handle, &plmn_int);
+	if( ret != NETWORK_INFO_ERROR_NONE )
+	{
+		return ret;
+	}
+
+	__convert_to_plmn(plmn_int, plmn);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// Gets the PLMN as stored in the key, e.g. 45005
+static int __get_plmn_value(network_info_h handle, int* plmn_int)
+{
+	telephony_key_values values;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	ret = __get_key_values((char*)__FUNCTION__, handle, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_PLMN), &values);
+	if( ret != NETWORK_INFO_ERROR_NONE )
+	{
+		return ret;
+	}
+
+	*plmn_int = values.plmn;
 
 	return NETWORK_INFO_ERROR_NONE;
 }
@@ -237,484 +816,2823 @@ int network_info_get_mnc(char** mnc)
 
 int network_info_get_provider_name(char** provider_name)
 {
+	return network_info_handle_get_provider_name(__get_default_handle(), provider_name);
+}
+
+int network_info_handle_get_provider_name(network_info_h handle, char** provider_name)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_PROVIDER_NAME, begin, __get_provider_name(handle, provider_name));
+}
+
+static int __get_provider_name(network_info_h handle, char** provider_name)
+{
+	telephony_state current;
+	const char* known_provider_name = NULL;
 	char* provider_name_p = NULL;
 	int ret = NETWORK_INFO_ERROR_NONE;
 	
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
 	NETWORK_INFO_CHECK_INPUT_PARAMETER(provider_name);
 	
-	ret = __check_service_state((char*)__FUNCTION__);
+	ret = __check_service_state((char*)__FUNCTION__, handle->slot, &current);
 	if( ret != NETWORK_INFO_ERROR_NONE )
 	{
 		return ret;
 	}
 
-	provider_name_p = vconf_get_str(VCONFKEY_TELEPHONY_NWNAME);
-	if( provider_name_p == NULL )
+	if( __cache_is_usable(handle, &current) == true )
+	{
+		known_provider_name = current.cache_values.provider_name;
+	}
+	else if( current.provider_name_is_tracked == true )
+	{
+		known_provider_name = current.provider_name;
+	}
+
+	// a name which may have been cut to the buffer is read again in full
+	if( known_provider_name != NULL && _network_info_str_may_be_cut(known_provider_name, NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1) == false )
+	{
+		provider_name_p = strdup(known_provider_name);
+		if( provider_name_p == NULL )
+		{
+			LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+			return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	else
+	{
+		provider_name_p = _network_info_backend_get_str(handle->slot->keys[NETWORK_INFO_KEY_NWNAME].info.key);
+	}
+
+	if( provider_name_p == NULL )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	*provider_name = provider_name_p;
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_copy_provider_name(char* buffer, int buffer_size, unsigned int* generation)
+{
+	return network_info_handle_copy_provider_name(__get_default_handle(), buffer, buffer_size, generation);
+}
+
+int network_info_handle_copy_provider_name(network_info_h handle, char* buffer, int buffer_size, unsigned int* generation)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_COPY_PROVIDER_NAME, begin, __copy_provider_name(handle, buffer, buffer_size, generation));
+}
+
+static int __copy_provider_name(network_info_h handle, char* buffer, int buffer_size, unsigned int* generation)
+{
+	telephony_state current;
+	char* provider_name = NULL;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(buffer);
+
+	if( buffer_size <= 0 )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : buffer_size(%d)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER, buffer_size);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	ret = __check_service_state((char*)__FUNCTION__, handle->slot, &current);
+	if( ret != NETWORK_INFO_ERROR_NONE )
+	{
+		return ret;
+	}
+
+	// nothing keeps the name up to date without a subscription, so it is read, and the generation follows the name read last
+	if( current.provider_name_is_tracked == false )
+	{
+		provider_name = _network_info_backend_get_str(handle->slot->keys[NETWORK_INFO_KEY_NWNAME].info.key);
+		if( provider_name == NULL )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get provider name", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+
+		g_rec_mutex_lock(&network_info_lock);
+		__update_provider_name(handle->slot, provider_name);
+		g_rec_mutex_unlock(&network_info_lock);
+		free(provider_name);
+
+		__read_state(handle->slot, &current);
+	}
+
+	_network_info_copy_str(buffer, buffer_size, current.provider_name);
+	if( generation != NULL )
+	{
+		*generation = current.provider_name_generation;
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+
+int network_info_get_type(network_info_type_e* network_type)
+{
+	return network_info_handle_get_type(__get_default_handle(), network_type);
+}
+
+int network_info_handle_get_type(network_info_h handle, network_info_type_e* network_type)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_TYPE, begin, __get_type(handle, network_type));
+}
+
+static int __get_type(network_info_h handle, network_info_type_e* network_type)
+{
+	telephony_key_values values;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(network_type);
+
+	ret = __get_key_values((char*)__FUNCTION__, handle, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_SVCTYPE), &values);
+	if( ret != NETWORK_INFO_ERROR_NONE )
+	{
+		return ret;
+	}
+
+	*network_type = __convert_service_type_to_network_type(values.service_type);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+
+int network_info_get_service_state(network_info_service_state_e* network_service_state)
+{
+	return network_info_handle_get_service_state(__get_default_handle(), network_service_state);
+}
+
+int network_info_handle_get_service_state(network_info_h handle, network_info_service_state_e* network_service_state)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_SERVICE_STATE, begin, __get_service_state(handle, network_service_state));
+}
+
+static int __get_service_state(network_info_h handle, network_info_service_state_e* network_service_state)
+{
+	telephony_state current;
+	telephony_key_values values;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(network_service_state);
+
+	__read_state(handle->slot, &current);
+	if( __cache_is_usable(handle, &current) == true )
+	{
+		values = current.cache_values;
+	}
+	else if( __read_keys(handle->slot, NETWORK_INFO_SERVICE_STATE_KEYS, &values) != 0 )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get service state", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	*network_service_state = __convert_to_service_state(values.service_type, values.cs_status, values.is_flight_mode);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_get_snapshot(network_info_snapshot_s* snapshot)
+{
+	return network_info_handle_get_snapshot(__get_default_handle(), snapshot);
+}
+
+int network_info_handle_get_snapshot(network_info_h handle, network_info_snapshot_s* snapshot)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_SNAPSHOT, begin, __get_snapshot(handle, snapshot));
+}
+
+static int __get_snapshot(network_info_h handle, network_info_snapshot_s* snapshot)
+{
+	telephony_state current;
+	telephony_key_values values;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(snapshot);
+
+	memset(snapshot, 0x00, sizeof(network_info_snapshot_s));
+	snapshot->service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+
+	__read_state(handle->slot, &current);
+	if( __cache_is_usable(handle, &current) == true )
+	{
+		values = current.cache_values;
+	}
+	else if( __read_key_values(handle->slot, &values) != 0 )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get keys", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	if( __convert_to_snapshot(&values, snapshot) != NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+	{
+		LOGE("[%s] OUT_OF_SERVICE(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_SERVICE);
+		return NETWORK_INFO_ERROR_OUT_OF_SERVICE;
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_get_serving_cell(network_info_serving_cell_s* serving_cell)
+{
+	return network_info_handle_get_serving_cell(__get_default_handle(), serving_cell);
+}
+
+int network_info_handle_get_serving_cell(network_info_h handle, network_info_serving_cell_s* serving_cell)
+{
+	unsigned long long begin = _network_info_stats_begin();
+
+	return _network_info_stats_end(NETWORK_INFO_API_GET_SERVING_CELL, begin, __get_serving_cell(handle, serving_cell));
+}
+
+static int __get_serving_cell(network_info_h handle, network_info_serving_cell_s* serving_cell)
+{
+	telephony_key_values values;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(serving_cell);
+
+	// the values are read in one request, so that a change of the cell is rarely seen partly
+	ret = __get_key_values((char*)__FUNCTION__, handle, NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_PLMN) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_LAC) | NETWORK_INFO_KEY_BIT(NETWORK_INFO_KEY_CELL_ID), &values);
+	if( ret != NETWORK_INFO_ERROR_NONE )
+	{
+		return ret;
+	}
+
+	__convert_to_serving_cell(&values, serving_cell);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_get_snapshot_async(network_info_snapshot_cb callback, void* user_data)
+{
+	return network_info_handle_get_snapshot_async(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_get_snapshot_async(network_info_h handle, network_info_snapshot_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __request_async(handle, NETWORK_INFO_API_GET_SNAPSHOT, callback, user_data);
+}
+
+int network_info_get_serving_cell_async(network_info_serving_cell_cb callback, void* user_data)
+{
+	return network_info_handle_get_serving_cell_async(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_get_serving_cell_async(network_info_h handle, network_info_serving_cell_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __request_async(handle, NETWORK_INFO_API_GET_SERVING_CELL, callback, user_data);
+}
+
+static int __request_async(network_info_h handle, network_info_api_e api, void* callback, void* user_data)
+{
+	telephony_async_request* request = NULL;
+	GThread* thread = NULL;
+
+	request = (telephony_async_request*)calloc(1, sizeof(telephony_async_request));
+	if( request == NULL )
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+		return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	request->api = api;
+	request->slot = handle->slot;
+	request->use_cache = __atomic_load_n(&handle->cache_is_enabled, __ATOMIC_RELAXED);
+	request->callback = callback;
+	request->user_data = user_data;
+	request->context = g_main_context_ref_thread_default();
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	// the request shares the read in progress, if any
+	if( async_read_is_running == false )
+	{
+		thread = g_thread_try_new("network-info-read", __async_read_thread_func, NULL, NULL);
+		if( thread == NULL )
+		{
+			g_rec_mutex_unlock(&network_info_lock);
+			__free_async_request(request);
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to create thread", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+
+		g_thread_unref(thread);
+		async_read_is_running = true;
+	}
+
+	g_queue_push_tail(&async_requests, request);
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// Reads the keys once for each slot, and completes all requests of the slot with the values
+static gpointer __async_read_thread_func(gpointer data)
+{
+	telephony_state current;
+	telephony_key_values values;
+	telephony_async_request* request = NULL;
+	telephony_slot* slot = NULL;
+	bool use_cache = false;
+	GList* link = NULL;
+	GList* next = NULL;
+	GSource* source = NULL;
+	int result = NETWORK_INFO_ERROR_NONE;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	while( (request = (telephony_async_request*)g_queue_peek_head(&async_requests)) != NULL )
+	{
+		slot = request->slot;
+		use_cache = request->use_cache;
+
+		g_rec_mutex_unlock(&network_info_lock);
+
+		// the keys are read without the lock, so that the other calls are not blocked
+		result = NETWORK_INFO_ERROR_NONE;
+		__read_state(slot, &current);
+		if( use_cache == true && current.cache_is_valid == true )
+		{
+			values = current.cache_values;
+		}
+		else if( __read_key_values(slot, &values) != 0 )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get keys", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+			result = NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+
+		g_rec_mutex_lock(&network_info_lock);
+
+		// the requests queued during the read are completed as well
+		for( link = async_requests.head; link != NULL; link = next )
+		{
+			next = link->next;
+			request = (telephony_async_request*)link->data;
+			if( request->slot != slot || request->use_cache != use_cache )
+			{
+				continue;
+			}
+
+			g_queue_delete_link(&async_requests, link);
+
+			request->result = result;
+			request->values = values;
+
+			source = g_idle_source_new();
+			g_source_set_callback(source, __async_request_cb, request, __free_async_request);
+			g_source_attach(source, request->context);
+			g_source_unref(source);
+		}
+	}
+
+	async_read_is_running = false;
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return NULL;
+}
+
+static gboolean __async_request_cb(gpointer user_data)
+{
+	telephony_async_request* request = (telephony_async_request*)user_data;
+	network_info_snapshot_s snapshot;
+	network_info_serving_cell_s serving_cell;
+	int result = request->result;
+
+	memset(&snapshot, 0x00, sizeof(network_info_snapshot_s));
+	memset(&serving_cell, 0x00, sizeof(network_info_serving_cell_s));
+
+	if( result == NETWORK_INFO_ERROR_NONE && __convert_to_snapshot(&request->values, &snapshot) != NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+	{
+		result = NETWORK_INFO_ERROR_OUT_OF_SERVICE;
+	}
+
+	switch(request->api)
+	{
+		case NETWORK_INFO_API_GET_SNAPSHOT:
+			((network_info_snapshot_cb)request->callback)(result, &snapshot, request->user_data);
+			break;
+		case NETWORK_INFO_API_GET_SERVING_CELL:
+			if( result == NETWORK_INFO_ERROR_NONE )
+			{
+				__convert_to_serving_cell(&request->values, &serving_cell);
+			}
+			((network_info_serving_cell_cb)request->callback)(result, &serving_cell, request->user_data);
+			break;
+		default:
+			break;
+	}
+
+	return FALSE;
+}
+
+static void __free_async_request(gpointer data)
+{
+	telephony_async_request* request = (telephony_async_request*)data;
+
+	g_main_context_unref(request->context);
+	free(request);
+}
+
+int network_info_enable_cache()
+{
+	return network_info_handle_enable_cache(__get_default_handle());
+}
+
+int network_info_handle_enable_cache(network_info_h handle)
+{
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( handle->cache_is_enabled == true )
+	{
+		g_rec_mutex_unlock(&network_info_lock);
+		return NETWORK_INFO_ERROR_NONE;
+	}
+
+	// register first, so that no change is lost between the read and the registration
+	if( __ref_watch(handle->slot, NETWORK_INFO_WATCH_CACHE) != NETWORK_INFO_ERROR_NONE )
+	{
+		g_rec_mutex_unlock(&network_info_lock);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	__atomic_store_n(&handle->cache_is_enabled, true, __ATOMIC_RELAXED);
+
+	ret = network_info_handle_refresh_cache(handle);
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+int network_info_disable_cache()
+{
+	return network_info_handle_disable_cache(__get_default_handle());
+}
+
+int network_info_handle_disable_cache(network_info_h handle)
+{
+	telephony_slot* slot = NULL;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	slot = handle->slot;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( handle->cache_is_enabled == true )
+	{
+		__unref_watch(slot, NETWORK_INFO_WATCH_CACHE);
+
+		__atomic_store_n(&handle->cache_is_enabled, false, __ATOMIC_RELAXED);
+
+		// the cache of the slot is shared by the handles which enable it
+		if( slot->watch_ref_counts[NETWORK_INFO_WATCH_CACHE] == 0 )
+		{
+			__begin_state_update(slot);
+			slot->state.cache_is_valid = false;
+			__end_state_update(slot);
+		}
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_refresh_cache()
+{
+	return network_info_handle_refresh_cache(__get_default_handle());
+}
+
+int network_info_handle_refresh_cache(network_info_h handle)
+{
+	telephony_slot* slot = NULL;
+	telephony_key_values values;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	slot = handle->slot;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( handle->cache_is_enabled == false )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : cache is not enabled", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+	else if( __read_key_values(slot, &values) != 0 )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get keys", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		__begin_state_update(slot);
+		slot->state.cache_is_valid = false;
+		__end_state_update(slot);
+		ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+	else
+	{
+		__begin_state_update(slot);
+		slot->state.cache_values = values;
+		slot->state.cache_is_valid = true;
+		__end_state_update(slot);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+int network_info_enable_history()
+{
+	int ret = NETWORK_INFO_ERROR_NONE;
+	int i = 0;
+
+	__init_slots();
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( history_is_enabled == true )
+	{
+		g_rec_mutex_unlock(&network_info_lock);
+		return NETWORK_INFO_ERROR_NONE;
+	}
+
+	for( i = 0; i < NETWORK_INFO_SLOT_COUNT; i++ )
+	{
+		if( __slot_is_supported(i) == false )
+		{
+			continue;
+		}
+
+		ret = __register_history_watch(&slots[i]);
+		if( ret != NETWORK_INFO_ERROR_NONE )
+		{
+			while( --i >= 0 )
+			{
+				if( __slot_is_supported(i) == true )
+				{
+					__unregister_history_watch(&slots[i]);
+				}
+			}
+			break;
+		}
+	}
+
+	if( ret == NETWORK_INFO_ERROR_NONE )
+	{
+		history_is_enabled = true;
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+int network_info_disable_history()
+{
+	int i = 0;
+
+	__init_slots();
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( history_is_enabled == true )
+	{
+		for( i = 0; i < NETWORK_INFO_SLOT_COUNT; i++ )
+		{
+			if( __slot_is_supported(i) == true )
+			{
+				__unregister_history_watch(&slots[i]);
+			}
+		}
+
+		history_is_enabled = false;
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_set_service_state_changed_cb(network_info_service_state_changed_cb callback, void* user_data)
+{
+	return network_info_handle_set_service_state_changed_cb(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_set_service_state_changed_cb(network_info_h handle, network_info_service_state_changed_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __set_legacy_cb(handle, NETWORK_INFO_EVENT_SERVICE_STATE, callback, user_data);
+}
+
+int network_info_unset_service_state_changed_cb()
+{
+	return network_info_handle_unset_service_state_changed_cb(__get_default_handle());
+}
+
+int network_info_handle_unset_service_state_changed_cb(network_info_h handle)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	return __unset_legacy_cb(handle, NETWORK_INFO_EVENT_SERVICE_STATE);
+}
+
+
+int network_info_set_cell_id_changed_cb(network_info_cell_id_changed_cb callback, void* user_data)
+{
+	return network_info_handle_set_cell_id_changed_cb(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_set_cell_id_changed_cb(network_info_h handle, network_info_cell_id_changed_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __set_legacy_cb(handle, NETWORK_INFO_EVENT_CELL_ID, callback, user_data);
+}
+
+int network_info_unset_cell_id_changed_cb()
+{
+	return network_info_handle_unset_cell_id_changed_cb(__get_default_handle());
+}
+
+int network_info_handle_unset_cell_id_changed_cb(network_info_h handle)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	return __unset_legacy_cb(handle, NETWORK_INFO_EVENT_CELL_ID);
+}
+
+int network_info_set_rssi_changed_cb(network_info_rssi_changed_cb callback, void* user_data)
+{
+	return network_info_handle_set_rssi_changed_cb(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_set_rssi_changed_cb(network_info_h handle, network_info_rssi_changed_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __set_legacy_cb(handle, NETWORK_INFO_EVENT_RSSI, callback, user_data);
+}
+
+int network_info_unset_rssi_changed_cb()
+{
+	return network_info_handle_unset_rssi_changed_cb(__get_default_handle());
+}
+
+int network_info_handle_unset_rssi_changed_cb(network_info_h handle)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	return __unset_legacy_cb(handle, NETWORK_INFO_EVENT_RSSI);
+}
+
+int network_info_set_roaming_state_changed_cb(network_info_roaming_state_changed_cb callback, void* user_data)
+{
+	return network_info_handle_set_roaming_state_changed_cb(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_set_roaming_state_changed_cb(network_info_h handle, network_info_roaming_state_changed_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __set_legacy_cb(handle, NETWORK_INFO_EVENT_ROAMING_STATE, callback, user_data);
+}
+
+int network_info_unset_roaming_state_changed_cb()
+{
+	return network_info_handle_unset_roaming_state_changed_cb(__get_default_handle());
+}
+
+int network_info_handle_unset_roaming_state_changed_cb(network_info_h handle)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	return __unset_legacy_cb(handle, NETWORK_INFO_EVENT_ROAMING_STATE);
+}
+
+int network_info_set_provider_name_changed_cb(network_info_provider_name_changed_cb callback, void* user_data)
+{
+	return network_info_handle_set_provider_name_changed_cb(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_set_provider_name_changed_cb(network_info_h handle, network_info_provider_name_changed_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __set_legacy_cb(handle, NETWORK_INFO_EVENT_PROVIDER_NAME, callback, user_data);
+}
+
+int network_info_unset_provider_name_changed_cb()
+{
+	return network_info_handle_unset_provider_name_changed_cb(__get_default_handle());
+}
+
+int network_info_handle_unset_provider_name_changed_cb(network_info_h handle)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	return __unset_legacy_cb(handle, NETWORK_INFO_EVENT_PROVIDER_NAME);
+}
+
+int network_info_set_type_changed_cb(network_info_type_changed_cb callback, void* user_data)
+{
+	return network_info_handle_set_type_changed_cb(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_set_type_changed_cb(network_info_h handle, network_info_type_changed_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __set_legacy_cb(handle, NETWORK_INFO_EVENT_TYPE, callback, user_data);
+}
+
+int network_info_unset_type_changed_cb()
+{
+	return network_info_handle_unset_type_changed_cb(__get_default_handle());
+}
+
+int network_info_handle_unset_type_changed_cb(network_info_h handle)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	return __unset_legacy_cb(handle, NETWORK_INFO_EVENT_TYPE);
+}
+
+int network_info_set_plmn_changed_cb(network_info_plmn_changed_cb callback, void* user_data)
+{
+	return network_info_handle_set_plmn_changed_cb(__get_default_handle(), callback, user_data);
+}
+
+int network_info_handle_set_plmn_changed_cb(network_info_h handle, network_info_plmn_changed_cb callback, void* user_data)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+
+	return __set_legacy_cb(handle, NETWORK_INFO_EVENT_PLMN, callback, user_data);
+}
+
+int network_info_unset_plmn_changed_cb()
+{
+	return network_info_handle_unset_plmn_changed_cb(__get_default_handle());
+}
+
+int network_info_handle_unset_plmn_changed_cb(network_info_h handle)
+{
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+
+	return __unset_legacy_cb(handle, NETWORK_INFO_EVENT_PLMN);
+}
+
+int network_info_subscribe(network_info_event_e event, network_info_event_cb callback, void* user_data, network_info_subscription_h* subscription)
+{
+	return network_info_handle_subscribe(__get_default_handle(), event, callback, user_data, subscription);
+}
+
+int network_info_handle_subscribe(network_info_h handle, network_info_event_e event, network_info_event_cb callback, void* user_data, network_info_subscription_h* subscription)
+{
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(handle);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(subscription);
+
+	if( event < 0 || event >= NETWORK_INFO_EVENT_COUNT )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid event(%d)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER, event);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	g_rec_mutex_lock(&network_info_lock);
+	ret = __add_subscription(handle, event, callback, user_data, subscription);
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+int network_info_subscription_set_rssi_policy(network_info_subscription_h subscription, const network_info_rssi_policy_s* policy)
+{
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(subscription);
+
+	g_rec_mutex_lock(&network_info_lock);
+	ret = __set_rssi_policy(subscription, policy);
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+int network_info_subscription_set_rssi_thresholds(network_info_subscription_h subscription, const network_info_rssi_e* thresholds, int count)
+{
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(subscription);
+
+	g_rec_mutex_lock(&network_info_lock);
+	ret = __set_rssi_thresholds(subscription, thresholds, count);
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+int network_info_subscription_set_dispatch_mode(network_info_subscription_h subscription, network_info_dispatch_mode_e mode)
+{
+	GMainContext* context = NULL;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(subscription);
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	switch(mode)
+	{
+		case NETWORK_INFO_DISPATCH_INLINE:
+			break;
+		case NETWORK_INFO_DISPATCH_CALLER_CONTEXT:
+			context = g_main_context_ref_thread_default();
+			break;
+		case NETWORK_INFO_DISPATCH_THREAD:
+			context = __get_dispatch_context();
+			if( context == NULL )
+			{
+				LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to start dispatch thread", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+				ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+			else
+			{
+				g_main_context_ref(context);
+			}
+			break;
+		default:
+			LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid mode(%d)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER, mode);
+			ret = NETWORK_INFO_ERROR_INVALID_PARAMETER;
+			break;
+	}
+
+	if( ret == NETWORK_INFO_ERROR_NONE && subscription->is_removed == true )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : already unsubscribed", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		ret = NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if( ret == NETWORK_INFO_ERROR_NONE )
+	{
+		if( subscription->context != NULL )
+		{
+			g_main_context_unref(subscription->context);
+		}
+		subscription->context = context;
+	}
+	else if( context != NULL )
+	{
+		g_main_context_unref(context);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+int network_info_unsubscribe(network_info_subscription_h subscription)
+{
+	network_info_subscription_h removed_subscription = NULL;
+	int ret = NETWORK_INFO_ERROR_NONE;
+	bool is_waited = false;
+
+	NETWORK_INFO_CHECK_INPUT_PARAMETER(subscription);
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( subscription->is_removed == true )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : already unsubscribed", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		ret = NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+	else
+	{
+		// an inline callback holds network_info_lock, which the queued callback may be waiting for
+		is_waited = (dispatch_depth == 0);
+		removed_subscription = __ref_subscription(subscription);
+		ret = __remove_subscription(subscription);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	if( removed_subscription != NULL )
+	{
+		if( is_waited == true )
+		{
+			__wait_for_delivery(removed_subscription);
+		}
+		__unref_subscription(removed_subscription);
+	}
+
+	return ret;
+}
+
+void _network_info_lock()
+{
+	g_rec_mutex_lock(&network_info_lock);
+}
+
+void _network_info_unlock()
+{
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+const telephony_key_info* _network_info_get_keys(int* count)
+{
+	*count = NETWORK_INFO_KEY_COUNT;
+	return key_info;
+}
+
+static void __telephony_service_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_slot* slot = slot_key->slot;
+	network_info_service_state_e status = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	network_info_type_e network_type = NETWORK_INFO_TYPE_UNKNOWN;
+	bool was_in_service = false;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	was_in_service = (slot->state.service_state == NETWORK_INFO_SERVICE_STATE_IN_SERVICE);
+
+	// only the changed key is taken from the notification, the others are already known
+	__update_key_value(&slot->service_state_values, &slot_key->info, value);
+	status = __convert_to_service_state(slot->service_state_values.service_type, slot->service_state_values.cs_status, slot->service_state_values.is_flight_mode);
+
+	if( history_is_enabled == true )
+	{
+		__add_history(slot, NETWORK_INFO_HISTORY_SERVICE_STATE, status);
+	}
+
+	__begin_state_update(slot);
+	slot->state.service_state = status;
+	__end_state_update(slot);
+
+	__dispatch_event(slot, NETWORK_INFO_EVENT_SERVICE_STATE, status, &status);
+
+	// the network type is delivered only in service, and only when the mapped type changes
+	if( status == NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+	{
+		network_type = __convert_service_type_to_network_type(slot->service_state_values.service_type);
+		__dispatch_event(slot, NETWORK_INFO_EVENT_TYPE, network_type, &network_type);
+
+		// the serving cell is not delivered out of service, so the cell changed meanwhile is compared again
+		if( was_in_service == false && slot->watch_ref_counts[NETWORK_INFO_WATCH_SERVING_CELL] > 0 && slot->serving_cell_idle_id == 0 )
+		{
+			slot->serving_cell_idle_id = g_idle_add(__serving_cell_idle_cb, slot);
+		}
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static void __cell_id_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_state current;
+	int cell_id = 0;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( __check_service_state((char*)__FUNCTION__, slot_key->slot, &current) == NETWORK_INFO_ERROR_NONE )
+	{
+		cell_id = value->int_value;
+		__dispatch_event(slot_key->slot, NETWORK_INFO_EVENT_CELL_ID, cell_id, &cell_id);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static void __rssi_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_state current;
+	network_info_rssi_e rssi = NETWORK_INFO_RSSI_0;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( __check_service_state((char*)__FUNCTION__, slot_key->slot, &current) == NETWORK_INFO_ERROR_NONE )
+	{
+		rssi = value->int_value;
+		__dispatch_event(slot_key->slot, NETWORK_INFO_EVENT_RSSI, rssi, &rssi);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static void __roaming_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_state current;
+	bool is_roaming = false;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( __check_service_state((char*)__FUNCTION__, slot_key->slot, &current) == NETWORK_INFO_ERROR_NONE )
+	{
+		is_roaming = (value->int_value == VCONFKEY_TELEPHONY_SVC_ROAM_ON);
+		__dispatch_event(slot_key->slot, NETWORK_INFO_EVENT_ROAMING_STATE, is_roaming, &is_roaming);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static void __provider_name_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_slot* slot = slot_key->slot;
+	telephony_state current;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	__update_provider_name(slot, value->str_value != NULL ? value->str_value : "");
+
+	if( __check_service_state((char*)__FUNCTION__, slot, &current) == NETWORK_INFO_ERROR_NONE )
+	{
+		__dispatch_event(slot, NETWORK_INFO_EVENT_PROVIDER_NAME, (int)slot->state.provider_name_generation, slot->state.provider_name);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static void __plmn_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_state current;
+	network_info_plmn_s plmn;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	// the PLMN is compared as stored in the key, and decoded for the callbacks only
+	if( __check_service_state((char*)__FUNCTION__, slot_key->slot, &current) == NETWORK_INFO_ERROR_NONE )
+	{
+		__convert_to_plmn(value->int_value, &plmn);
+		__dispatch_event(slot_key->slot, NETWORK_INFO_EVENT_PLMN, value->int_value, &plmn);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static void __network_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_slot* slot = slot_key->slot;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	__update_key_value(&slot->network_values, &slot_key->info, value);
+
+	// the changes in the same main loop iteration are delivered together
+	if( slot->network_changed_idle_id == 0 )
+	{
+		slot->network_changed_idle_id = g_idle_add(__network_changed_idle_cb, slot);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static gboolean __network_changed_idle_cb(gpointer user_data)
+{
+	telephony_slot* slot = (telephony_slot*)user_data;
+	network_info_snapshot_s snapshot;
+	network_info_change_s change;
+	network_info_h handle = NULL;
+	GList* link = NULL;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	slot->network_changed_idle_id = 0;
+
+	__convert_to_snapshot(&slot->network_values, &snapshot);
+
+	// each handle is compared with the snapshot delivered to it last
+	__begin_dispatch(slot);
+	for( link = slot->handles.head; link != NULL; link = link->next )
+	{
+		handle = (network_info_h)link->data;
+		if( handle->is_destroyed == true || handle->event_data[NETWORK_INFO_EVENT_NETWORK_CHANGED].subscriber_count == 0 )
+		{
+			continue;
+		}
+
+		change.snapshot = snapshot;
+		change.changed_fields = __compare_snapshot(&handle->network_snapshot, &change.snapshot);
+		if( change.changed_fields != 0 )
+		{
+			handle->network_snapshot = change.snapshot;
+			__notify_subscriptions(handle, NETWORK_INFO_EVENT_NETWORK_CHANGED, 0, &change, 0);
+		}
+		else
+		{
+			_network_info_stats_suppressed();
+		}
+	}
+	__end_dispatch(slot);
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return FALSE;
+}
+
+static void __serving_cell_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_slot* slot = slot_key->slot;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	__update_key_value(&slot->serving_cell_values, &slot_key->info, value);
+
+	// the keys changed by a handover are delivered together
+	if( slot->serving_cell_idle_id == 0 )
+	{
+		slot->serving_cell_idle_id = g_idle_add(__serving_cell_idle_cb, slot);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static gboolean __serving_cell_idle_cb(gpointer user_data)
+{
+	telephony_slot* slot = (telephony_slot*)user_data;
+	network_info_serving_cell_s new_serving_cell;
+	telephony_state current;
+	network_info_h handle = NULL;
+	GList* link = NULL;
+	bool is_in_service = false;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	slot->serving_cell_idle_id = 0;
+
+	__convert_to_serving_cell(&slot->serving_cell_values, &new_serving_cell);
+
+	// each handle is compared with the serving cell delivered to it last
+	__begin_dispatch(slot);
+	for( link = slot->handles.head; link != NULL; link = link->next )
+	{
+		handle = (network_info_h)link->data;
+		if( handle->is_destroyed == true || handle->event_data[NETWORK_INFO_EVENT_SERVING_CELL].subscriber_count == 0 )
+		{
+			continue;
+		}
+
+		if( memcmp(&handle->serving_cell, &new_serving_cell, sizeof(network_info_serving_cell_s)) == 0 )
+		{
+			_network_info_stats_suppressed();
+			continue;
+		}
+
+		// the service state is checked once, when the first handle needs it
+		if( is_in_service == false && __check_service_state((char*)__FUNCTION__, slot, &current) != NETWORK_INFO_ERROR_NONE )
+		{
+			break;
+		}
+		is_in_service = true;
+
+		handle->serving_cell = new_serving_cell;
+		__notify_subscriptions(handle, NETWORK_INFO_EVENT_SERVING_CELL, 0, &new_serving_cell, 0);
+	}
+	__end_dispatch(slot);
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return FALSE;
+}
+
+static void __history_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	const telephony_history_key* history_key = NULL;
+	int i = 0;
+
+	for( i = 0; i < G_N_ELEMENTS(history_keys); i++ )
+	{
+		if( history_keys[i].key == slot_key->key )
+		{
+			history_key = &history_keys[i];
+		}
+	}
+
+	if( history_key == NULL )
+	{
+		return;
+	}
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	if( history_key->type == NETWORK_INFO_HISTORY_ROAMING_STATE )
+	{
+		__add_history(slot_key->slot, history_key->type, value->int_value == VCONFKEY_TELEPHONY_SVC_ROAM_ON);
+	}
+	else
+	{
+		__add_history(slot_key->slot, history_key->type, value->int_value);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+static void __legacy_cb_adapter(network_info_event_e event, void* data, void* user_data)
+{
+	telephony_cb_data* cb_data = (telephony_cb_data*)user_data;
+
+	switch(event)
+	{
+		case NETWORK_INFO_EVENT_SERVICE_STATE:
+			((network_info_service_state_changed_cb)(cb_data->cb))(*(network_info_service_state_e*)data, cb_data->user_data);
+			break;
+		case NETWORK_INFO_EVENT_CELL_ID:
+			LOGI("[%s] network_info_cell_id_changed_cb will be called", __FUNCTION__);
+			((network_info_cell_id_changed_cb)(cb_data->cb))(*(int*)data, cb_data->user_data);
+			break;
+		case NETWORK_INFO_EVENT_RSSI:
+			((network_info_rssi_changed_cb)(cb_data->cb))(*(network_info_rssi_e*)data, cb_data->user_data);
+			break;
+		case NETWORK_INFO_EVENT_ROAMING_STATE:
+			((network_info_roaming_state_changed_cb)(cb_data->cb))(*(bool*)data, cb_data->user_data);
+			break;
+		case NETWORK_INFO_EVENT_PROVIDER_NAME:
+			((network_info_provider_name_changed_cb)(cb_data->cb))((const char*)data, cb_data->user_data);
+			break;
+		case NETWORK_INFO_EVENT_TYPE:
+			((network_info_type_changed_cb)(cb_data->cb))(*(network_info_type_e*)data, cb_data->user_data);
+			break;
+		case NETWORK_INFO_EVENT_PLMN:
+			((network_info_plmn_changed_cb)(cb_data->cb))((const network_info_plmn_s*)data, cb_data->user_data);
+			break;
+		default:
+			break;
+	}
+}
+
+// Notified before the other adapters of the key, so that their callbacks see the new value in the cache
+static void __cache_changed_cb_adapter(const char* key, const telephony_key_value* value, void* user_data)
+{
+	const telephony_slot_key* slot_key = (const telephony_slot_key*)user_data;
+	telephony_slot* slot = slot_key->slot;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	__begin_state_update(slot);
+	__update_key_value(&slot->state.cache_values, &slot_key->info, value);
+	__end_state_update(slot);
+
+	g_rec_mutex_unlock(&network_info_lock);
+}
+
+
+static char* __convert_error_code_to_string(network_info_error_e error_code)
+{
+	switch(error_code)
+	{
+		case NETWORK_INFO_ERROR_OUT_OF_MEMORY:
+			return "OUT_OF_MEMORY";
+		case NETWORK_INFO_ERROR_INVALID_PARAMETER:
+			return "INVALID_PARAMETER";
+		case NETWORK_INFO_ERROR_OPERATION_FAILED:
+			return "OPERATION_FAILED";
+		case NETWORK_INFO_ERROR_OUT_OF_SERVICE:
+			return "OUT_OF_SERVICE";
+		case NETWORK_INFO_ERROR_NOT_SUPPORTED:
+			return "NOT_SUPPORTED";
+		default:
+			return "UNKNOWN";
+	}
+}
+
+static network_info_type_e __convert_service_type_to_network_type(int service_type)
+{
+	switch(service_type)
+	{
+		case VCONFKEY_TELEPHONY_SVCTYPE_2G:
+			return NETWORK_INFO_TYPE_GSM;
+		case VCONFKEY_TELEPHONY_SVCTYPE_2_5G:
+			return NETWORK_INFO_TYPE_GPRS;
+		case VCONFKEY_TELEPHONY_SVCTYPE_2_5G_EDGE:
+			return NETWORK_INFO_TYPE_EDGE;
+		case VCONFKEY_TELEPHONY_SVCTYPE_3G:
+			return NETWORK_INFO_TYPE_UMTS;
+		case VCONFKEY_TELEPHONY_SVCTYPE_HSDPA:
+			return NETWORK_INFO_TYPE_HSDPA;
+		default:
+			return NETWORK_INFO_TYPE_UNKNOWN;
+	}
+}
+
+static network_info_service_state_e __convert_to_service_state(int service_type, int cs_status, int is_flight_mode)
+{
+	if( service_type == VCONFKEY_TELEPHONY_SVCTYPE_EMERGENCY )
+	{
+		return NETWORK_INFO_SERVICE_STATE_EMERGENCY_ONLY;
+	}
+
+	if( cs_status == VCONFKEY_TELEPHONY_SVC_CS_ON )
+	{
+		return NETWORK_INFO_SERVICE_STATE_IN_SERVICE;
+	}
+
+	if( is_flight_mode == 1 )
+	{
+		return NETWORK_INFO_SERVICE_STATE_RADIO_OFF;
+	}
+
+	return NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+}
+
+// PLMN is MCC (three digits) followed by MNC (two or three digits), and MCC never starts with 0
+static void __convert_to_plmn(int plmn_int, network_info_plmn_s* plmn)
+{
+	char plmn_str[16] = "";
+	int plmn_length = 0;
+
+	memset(plmn, 0x00, sizeof(network_info_plmn_s));
+
+	plmn_length = snprintf(plmn_str, sizeof(plmn_str), "%d", plmn_int);
+	if( plmn_length < 3 )
+	{
+		return;
+	}
+
+	plmn->mnc_length = MIN(plmn_length - 3, 3);
+	memcpy(plmn->mcc_str, plmn_str, 3);
+	memcpy(plmn->mnc_str, plmn_str + 3, plmn->mnc_length);
+
+	plmn->mcc = atoi(plmn->mcc_str);
+	plmn->mnc = atoi(plmn->mnc_str);
+}
+
+static int __read_key_values(telephony_slot* slot, telephony_key_values* values)
+{
+	return __read_keys(slot, NETWORK_INFO_ALL_KEYS, values);
+}
+
+// Reads the keys of the slot with one backend request. The values of the other keys are cleared.
+static int __read_keys(telephony_slot* slot, unsigned int keys, telephony_key_values* values)
+{
+	telephony_key_info infos[NETWORK_INFO_KEY_COUNT];
+	int count = 0;
+	int i = 0;
+
+	memset(values, 0x00, sizeof(telephony_key_values));
+
+	for( i = 0; i < NETWORK_INFO_KEY_COUNT; i++ )
+	{
+		if( (keys & NETWORK_INFO_KEY_BIT(i)) != 0 )
+		{
+			infos[count++] = slot->keys[i].info;
+		}
+	}
+
+	return _network_info_backend_read_keys(infos, count, values);
+}
+
+// Gets the keys for a getter which requires the service.
+// The keys are taken from the cache if it is valid, otherwise they are read at once,
+// together with the service state keys if no watch keeps the service state up to date.
+static int __get_key_values(char* function_name, network_info_h handle, unsigned int keys, telephony_key_values* values)
+{
+	telephony_state current;
+	network_info_service_state_e service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	bool is_watched = false;
+
+	__read_state(handle->slot, &current);
+
+	is_watched = __get_watched_service_state(&current, &service_state);
+	if( is_watched == true )
+	{
+		// nothing has to be read out of service
+		if( service_state != NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+		{
+			LOGE("[%s] OUT_OF_SERVICE(0x%08x)", function_name, NETWORK_INFO_ERROR_OUT_OF_SERVICE);
+			return NETWORK_INFO_ERROR_OUT_OF_SERVICE;
+		}
+	}
+	else
+	{
+		keys |= NETWORK_INFO_SERVICE_STATE_KEYS;
+	}
+
+	if( __cache_is_usable(handle, &current) == true )
+	{
+		*values = current.cache_values;
+	}
+	else if( __read_keys(handle->slot, keys, values) != 0 )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x)", function_name, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	if( is_watched == false )
+	{
+		service_state = __convert_to_service_state(values->service_type, values->cs_status, values->is_flight_mode);
+		if( service_state != NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+		{
+			LOGE("[%s] OUT_OF_SERVICE(0x%08x)", function_name, NETWORK_INFO_ERROR_OUT_OF_SERVICE);
+			return NETWORK_INFO_ERROR_OUT_OF_SERVICE;
+		}
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// The cache of the slot is used only by the handles which enable it
+static bool __cache_is_usable(network_info_h handle, const telephony_state* current)
+{
+	return current->cache_is_valid == true && __atomic_load_n(&handle->cache_is_enabled, __ATOMIC_RELAXED) == true;
+}
+
+static void __update_key_value(telephony_key_values* values, const telephony_key_info* info, const telephony_key_value* value)
+{
+	char* value_p = (char*)values + info->offset;
+
+	switch(info->type)
+	{
+		case VCONF_TYPE_STRING:
+			_network_info_copy_str(value_p, NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1, value->str_value != NULL ? value->str_value : "");
+			break;
+		default:
+			*(int*)value_p = value->int_value;
+			break;
+	}
+}
+
+static void __convert_to_serving_cell(const telephony_key_values* values, network_info_serving_cell_s* serving_cell)
+{
+	memset(serving_cell, 0x00, sizeof(network_info_serving_cell_s));
+
+	__convert_to_plmn(values->plmn, &serving_cell->plmn);
+	serving_cell->lac = values->lac;
+	serving_cell->cell_id = values->cell_id;
+}
+
+// Fills snapshot in the same way as network_info_get_snapshot() and returns the service state
+static network_info_service_state_e __convert_to_snapshot(const telephony_key_values* values, network_info_snapshot_s* snapshot)
+{
+	network_info_plmn_s plmn;
+
+	memset(snapshot, 0x00, sizeof(network_info_snapshot_s));
+
+	snapshot->service_state = __convert_to_service_state(values->service_type, values->cs_status, values->is_flight_mode);
+	if( snapshot->service_state != NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+	{
+		return snapshot->service_state;
+	}
+
+	snapshot->network_type = __convert_service_type_to_network_type(values->service_type);
+	snapshot->lac = values->lac;
+	snapshot->cell_id = values->cell_id;
+	snapshot->rssi = values->rssi;
+	snapshot->is_roaming = (values->roaming_state == VCONFKEY_TELEPHONY_SVC_ROAM_ON);
+	memcpy(snapshot->provider_name, values->provider_name, sizeof(snapshot->provider_name));
+
+	__convert_to_plmn(values->plmn, &plmn);
+	memcpy(snapshot->mcc, plmn.mcc_str, sizeof(snapshot->mcc));
+	memcpy(snapshot->mnc, plmn.mnc_str, sizeof(snapshot->mnc));
+
+	return snapshot->service_state;
+}
+
+// Copies the state of the slot without taking network_info_lock, and retries if it is updated while being copied
+static void __read_state(telephony_slot* slot, telephony_state* current)
+{
+	unsigned int sequence = 0;
+
+	do
+	{
+		sequence = __atomic_load_n(&slot->state_sequence, __ATOMIC_ACQUIRE);
+		memcpy(current, &slot->state, sizeof(telephony_state));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while( (sequence & 1) != 0 || sequence != __atomic_load_n(&slot->state_sequence, __ATOMIC_RELAXED) );
+}
+
+// The state may be changed only between __begin_state_update() and __end_state_update(), with network_info_lock held
+static void __begin_state_update(telephony_slot* slot)
+{
+	__atomic_store_n(&slot->state_sequence, slot->state_sequence + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void __end_state_update(telephony_slot* slot)
+{
+	__atomic_store_n(&slot->state_sequence, slot->state_sequence + 1, __ATOMIC_RELEASE);
+}
+
+// Names the keys of the slots and creates the default handle, once in the process
+static void __init_slots()
+{
+	telephony_slot* slot = NULL;
+	int i = 0;
+	int k = 0;
+
+	if( g_once_init_enter(&slots_are_initialized) == FALSE )
+	{
+		return;
+	}
+
+	for( i = 0; i < NETWORK_INFO_SLOT_COUNT; i++ )
+	{
+		slot = &slots[i];
+		slot->index = i;
+		slot->state.service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+		g_queue_init(&slot->handles);
+
+		for( k = 0; k < NETWORK_INFO_KEY_COUNT; k++ )
+		{
+			slot->keys[k].info = key_info[k];
+			slot->keys[k].info.key = slot_key_names[i][k];
+			slot->keys[k].slot = slot;
+			slot->keys[k].key = k;
+		}
+	}
+
+	__init_handle(&default_handle, &slots[0]);
+	g_queue_push_tail_link(&slots[0].handles, &default_handle.link);
+
+	g_once_init_leave(&slots_are_initialized, 1);
+}
+
+// The keys of the slots other than 0 are set only in the in-memory store
+static bool __slot_is_supported(int index)
+{
+	return index == 0 || _network_info_backend_is_memory() == true;
+}
+
+static void __init_handle(network_info_h handle, telephony_slot* slot)
+{
+	int i = 0;
+
+	handle->slot = slot;
+	handle->link.data = handle;
+
+	for( i = 0; i < NETWORK_INFO_EVENT_COUNT; i++ )
+	{
+		handle->event_data[i].previous_value = initial_event_values[i];
+		g_queue_init(&handle->event_data[i].subscriptions);
+	}
+}
+
+static network_info_h __get_default_handle()
+{
+	__init_slots();
+
+	return &default_handle;
+}
+
+// Must be called with network_info_lock held, after all subscriptions of the handle are removed
+static void __free_handle(network_info_h handle)
+{
+	int i = 0;
+
+	for( i = 0; i < NETWORK_INFO_EVENT_COUNT; i++ )
+	{
+		__purge_subscriptions(&handle->event_data[i]);
+	}
+
+	g_queue_unlink(&handle->slot->handles, &handle->link);
+	free(handle);
+}
+
+// The name is tracked while a handle of the slot subscribes to its changes, see __register_event_watch()
+static int __start_provider_name_tracking(telephony_slot* slot)
+{
+	char* provider_name = NULL;
+	bool is_watched = false;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	// register first, so that no change is lost between the read and the registration
+	is_watched = (slot->watch_ref_counts[NETWORK_INFO_WATCH_PROVIDER_NAME] > 0);
+	if( __ref_watch(slot, NETWORK_INFO_WATCH_PROVIDER_NAME) != NETWORK_INFO_ERROR_NONE )
+	{
+		g_rec_mutex_unlock(&network_info_lock);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	if( is_watched == false )
+	{
+		provider_name = _network_info_backend_get_str(slot->keys[NETWORK_INFO_KEY_NWNAME].info.key);
+		if( provider_name == NULL )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get provider name", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+			__unref_watch(slot, NETWORK_INFO_WATCH_PROVIDER_NAME);
+			g_rec_mutex_unlock(&network_info_lock);
+			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+
+		__update_provider_name(slot, provider_name);
+		free(provider_name);
+
+		__begin_state_update(slot);
+		slot->state.provider_name_is_tracked = true;
+		__end_state_update(slot);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+static int __stop_provider_name_tracking(telephony_slot* slot)
+{
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	g_rec_mutex_lock(&network_info_lock);
+
+	ret = __unref_watch(slot, NETWORK_INFO_WATCH_PROVIDER_NAME);
+
+	if( slot->watch_ref_counts[NETWORK_INFO_WATCH_PROVIDER_NAME] == 0 && slot->state.provider_name_is_tracked == true )
+	{
+		__begin_state_update(slot);
+		slot->state.provider_name_is_tracked = false;
+		__end_state_update(slot);
+	}
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
+}
+
+// Must be called with network_info_lock held
+static void __update_provider_name(telephony_slot* slot, const char* provider_name)
+{
+	char cut_provider_name[NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1];
+
+	_network_info_copy_str(cut_provider_name, sizeof(cut_provider_name), provider_name);
+
+	if( strcmp(slot->state.provider_name, cut_provider_name) != 0 )
+	{
+		__begin_state_update(slot);
+		memcpy(slot->state.provider_name, cut_provider_name, sizeof(cut_provider_name));
+		slot->state.provider_name_generation++;
+		__end_state_update(slot);
+	}
+}
+
+// The service state is recorded by __telephony_service_changed_cb_adapter, and the other values by __history_changed_cb_adapter.
+// Must be called with network_info_lock held.
+static int __register_history_watch(telephony_slot* slot)
+{
+	int i = 0;
+
+	if( __register_service_state_watch(slot) != NETWORK_INFO_ERROR_NONE )
+	{
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	if( __ref_watch(slot, NETWORK_INFO_WATCH_HISTORY) != NETWORK_INFO_ERROR_NONE )
+	{
+		__unregister_service_state_watch(slot);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	// the changes made while the history was disabled are not known, so the first value of each type is recorded
+	for( i = 0; i < NETWORK_INFO_HISTORY_TYPE_COUNT; i++ )
+	{
+		slot->history_value_is_known[i] = false;
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// Must be called with network_info_lock held
+static void __unregister_history_watch(telephony_slot* slot)
+{
+	__unref_watch(slot, NETWORK_INFO_WATCH_HISTORY);
+	__unregister_service_state_watch(slot);
+}
+
+// Records a value which differs from the value of the same type recorded last for the slot.
+// Must be called with network_info_lock held.
+static void __add_history(telephony_slot* slot, network_info_history_type_e type, int value)
+{
+	if( slot->history_value_is_known[type] == true && slot->history_values[type] == value )
+	{
+		return;
+	}
+
+	slot->history_values[type] = value;
+	slot->history_value_is_known[type] = true;
+
+	_network_info_history_add(slot->index, type, value);
+}
+
+// The service state is tracked only while the watch has users, since its notifications arrive only in a process running the main loop.
+// The users are the subscriptions of the events, which are delivered from the same notifications, and the event history.
+// Must be called with network_info_lock held.
+static int __register_service_state_watch(telephony_slot* slot)
+{
+	telephony_key_values* values = &slot->service_state_values;
+
+	if( slot->watch_ref_counts[NETWORK_INFO_WATCH_SERVICE_STATE] > 0 )
+	{
+		return __ref_watch(slot, NETWORK_INFO_WATCH_SERVICE_STATE);
+	}
+
+	// register first, so that no change is lost between the read and the registration
+	if( __ref_watch(slot, NETWORK_INFO_WATCH_SERVICE_STATE) != NETWORK_INFO_ERROR_NONE )
+	{
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	if( __read_keys(slot, NETWORK_INFO_SERVICE_STATE_KEYS, values) != 0 )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get service state", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		__unref_watch(slot, NETWORK_INFO_WATCH_SERVICE_STATE);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	__begin_state_update(slot);
+	slot->state.service_state = __convert_to_service_state(values->service_type, values->cs_status, values->is_flight_mode);
+	slot->state.service_state_is_tracked = true;
+	__end_state_update(slot);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// Must be called with network_info_lock held
+static int __unregister_service_state_watch(telephony_slot* slot)
+{
+	int ret = __unref_watch(slot, NETWORK_INFO_WATCH_SERVICE_STATE);
+
+	if( slot->watch_ref_counts[NETWORK_INFO_WATCH_SERVICE_STATE] == 0 && slot->state.service_state_is_tracked == true )
+	{
+		__begin_state_update(slot);
+		slot->state.service_state_is_tracked = false;
+		__end_state_update(slot);
+	}
+
+	return ret;
+}
+
+// Refs a watch whose adapter delivers only in service, together with the service state watch,
+// so that the adapter checks the service state kept by the watch instead of reading the keys at each notification.
+// Must be called with network_info_lock held.
+static int __register_gated_watch(telephony_slot* slot, telephony_watch_e watch)
+{
+	if( __register_service_state_watch(slot) != NETWORK_INFO_ERROR_NONE )
+	{
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	if( __ref_watch(slot, watch) != NETWORK_INFO_ERROR_NONE )
+	{
+		__unregister_service_state_watch(slot);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// Must be called with network_info_lock held
+static int __unregister_gated_watch(telephony_slot* slot, telephony_watch_e watch)
+{
+	int ret = __unref_watch(slot, watch);
+
+	if( __unregister_service_state_watch(slot) != NETWORK_INFO_ERROR_NONE )
+	{
+		ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	return ret;
+}
+
+// Gets the service state kept up to date by the service state watch or the cache watch, without reading any key.
+// Returns false if neither watch has users.
+static bool __get_watched_service_state(const telephony_state* current, network_info_service_state_e* service_state)
+{
+	if( current->service_state_is_tracked == true )
+	{
+		*service_state = current->service_state;
+		return true;
+	}
+
+	if( current->cache_is_valid == true )
+	{
+		*service_state = __convert_to_service_state(current->cache_values.service_type, current->cache_values.cs_status, current->cache_values.is_flight_mode);
+		return true;
+	}
+
+	return false;
+}
+
+// Copies the state of the slot into current as well, so that the caller can use the same state
+static int __check_service_state(char* function_name, telephony_slot* slot, telephony_state* current)
+{
+	network_info_service_state_e service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	telephony_key_values values;
+
+	__read_state(slot, current);
+
+	// the keys are read only if no watch keeps the service state up to date
+	if( __get_watched_service_state(current, &service_state) == false )
+	{
+		if( __read_keys(slot, NETWORK_INFO_SERVICE_STATE_KEYS, &values) != 0 )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x)", function_name, NETWORK_INFO_ERROR_OPERATION_FAILED);
+			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+		service_state = __convert_to_service_state(values.service_type, values.cs_status, values.is_flight_mode);
+	}
+
+	if( service_state != NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+	{
+		LOGE("[%s] OUT_OF_SERVICE(0x%08x)", function_name, NETWORK_INFO_ERROR_OUT_OF_SERVICE);
+		return NETWORK_INFO_ERROR_OUT_OF_SERVICE;
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+static int __get_event_value(network_info_h handle, network_info_event_e event, int* value)
+{
+	telephony_slot* slot = handle->slot;
+	network_info_rssi_e rssi = NETWORK_INFO_RSSI_0;
+	bool is_roaming = false;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	switch(event)
+	{
+		case NETWORK_INFO_EVENT_SERVICE_STATE:
+			// tracked by the watch of the event
+			*value = slot->state.service_state;
+			break;
+		case NETWORK_INFO_EVENT_CELL_ID:
+			ret = __get_cell_id(handle, value);
+			break;
+		case NETWORK_INFO_EVENT_RSSI:
+			ret = __get_rssi(handle, &rssi);
+			*value = rssi;
+			break;
+		case NETWORK_INFO_EVENT_ROAMING_STATE:
+			ret = __is_roaming(handle, &is_roaming);
+			*value = is_roaming;
+			break;
+		case NETWORK_INFO_EVENT_NETWORK_CHANGED:
+		case NETWORK_INFO_EVENT_SERVING_CELL:
+			// the changes are found by comparing the values delivered last
+			*value = 0;
+			break;
+		case NETWORK_INFO_EVENT_PROVIDER_NAME:
+			// the generation identifies the name
+			*value = (int)slot->state.provider_name_generation;
+			break;
+		case NETWORK_INFO_EVENT_TYPE:
+			// mapped from the tracked service type, without reading the key
+			*value = __convert_service_type_to_network_type(slot->service_state_values.service_type);
+			break;
+		case NETWORK_INFO_EVENT_PLMN:
+			ret = __get_plmn_value(handle, value);
+			break;
+		default:
+			ret = NETWORK_INFO_ERROR_INVALID_PARAMETER;
+			break;
+	}
+
+	return ret;
+}
+
+// The watches of a slot are shared by its handles, so the values watched for an event are read only by the first handle
+static int __register_event_watch(network_info_h handle, network_info_event_e event)
+{
+	telephony_slot* slot = handle->slot;
+	bool is_watched = false;
+
+	switch(event)
+	{
+		case NETWORK_INFO_EVENT_SERVICE_STATE:
+		case NETWORK_INFO_EVENT_TYPE:
+			return __register_service_state_watch(slot);
+		case NETWORK_INFO_EVENT_PROVIDER_NAME:
+			if( __register_service_state_watch(slot) != NETWORK_INFO_ERROR_NONE )
+			{
+				return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+			if( __start_provider_name_tracking(slot) != NETWORK_INFO_ERROR_NONE )
+			{
+				__unregister_service_state_watch(slot);
+				return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+			break;
+		case NETWORK_INFO_EVENT_CELL_ID:
+			return __register_gated_watch(slot, NETWORK_INFO_WATCH_CELL_ID);
+		case NETWORK_INFO_EVENT_RSSI:
+			return __register_gated_watch(slot, NETWORK_INFO_WATCH_RSSI);
+		case NETWORK_INFO_EVENT_ROAMING_STATE:
+			return __register_gated_watch(slot, NETWORK_INFO_WATCH_ROAMING_STATE);
+		case NETWORK_INFO_EVENT_PLMN:
+			return __register_gated_watch(slot, NETWORK_INFO_WATCH_PLMN);
+		case NETWORK_INFO_EVENT_NETWORK_CHANGED:
+			is_watched = (slot->watch_ref_counts[NETWORK_INFO_WATCH_NETWORK_CHANGED] > 0);
+			if( __ref_watch(slot, NETWORK_INFO_WATCH_NETWORK_CHANGED) != NETWORK_INFO_ERROR_NONE )
+			{
+				return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+
+			if( is_watched == false && __read_key_values(slot, &slot->network_values) != 0 )
+			{
+				LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get keys", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+				__unref_watch(slot, NETWORK_INFO_WATCH_NETWORK_CHANGED);
+				return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+			__convert_to_snapshot(&slot->network_values, &handle->network_snapshot);
+			break;
+		case NETWORK_INFO_EVENT_SERVING_CELL:
+			// the service state is watched too, so that a cell changed out of service is delivered when the service returns
+			is_watched = (slot->watch_ref_counts[NETWORK_INFO_WATCH_SERVING_CELL] > 0);
+			if( __register_gated_watch(slot, NETWORK_INFO_WATCH_SERVING_CELL) != NETWORK_INFO_ERROR_NONE )
+			{
+				return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+
+			if( is_watched == false && __read_key_values(slot, &slot->serving_cell_values) != 0 )
+			{
+				LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get keys", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+				__unregister_gated_watch(slot, NETWORK_INFO_WATCH_SERVING_CELL);
+				return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+			__convert_to_serving_cell(&slot->serving_cell_values, &handle->serving_cell);
+			break;
+		default:
+			return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+static int __unregister_event_watch(network_info_h handle, network_info_event_e event)
+{
+	telephony_slot* slot = handle->slot;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	switch(event)
+	{
+		case NETWORK_INFO_EVENT_SERVICE_STATE:
+		case NETWORK_INFO_EVENT_TYPE:
+			return __unregister_service_state_watch(slot);
+		case NETWORK_INFO_EVENT_PROVIDER_NAME:
+			ret = __stop_provider_name_tracking(slot);
+			if( __unregister_service_state_watch(slot) != NETWORK_INFO_ERROR_NONE )
+			{
+				ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
+			}
+			return ret;
+		case NETWORK_INFO_EVENT_CELL_ID:
+			return __unregister_gated_watch(slot, NETWORK_INFO_WATCH_CELL_ID);
+		case NETWORK_INFO_EVENT_RSSI:
+			return __unregister_gated_watch(slot, NETWORK_INFO_WATCH_RSSI);
+		case NETWORK_INFO_EVENT_ROAMING_STATE:
+			return __unregister_gated_watch(slot, NETWORK_INFO_WATCH_ROAMING_STATE);
+		case NETWORK_INFO_EVENT_PLMN:
+			return __unregister_gated_watch(slot, NETWORK_INFO_WATCH_PLMN);
+		case NETWORK_INFO_EVENT_NETWORK_CHANGED:
+			ret = __unref_watch(slot, NETWORK_INFO_WATCH_NETWORK_CHANGED);
+
+			if( slot->watch_ref_counts[NETWORK_INFO_WATCH_NETWORK_CHANGED] == 0 && slot->network_changed_idle_id != 0 )
+			{
+				g_source_remove(slot->network_changed_idle_id);
+				slot->network_changed_idle_id = 0;
+			}
+			return ret;
+		case NETWORK_INFO_EVENT_SERVING_CELL:
+			ret = __unregister_gated_watch(slot, NETWORK_INFO_WATCH_SERVING_CELL);
+
+			if( slot->watch_ref_counts[NETWORK_INFO_WATCH_SERVING_CELL] == 0 && slot->serving_cell_idle_id != 0 )
+			{
+				g_source_remove(slot->serving_cell_idle_id);
+				slot->serving_cell_idle_id = 0;
+			}
+			return ret;
+		default:
+			return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// Must be called with network_info_lock held
+static int __ref_watch(telephony_slot* slot, telephony_watch_e watch)
+{
+	const telephony_watch* watch_p = &watches[watch];
+	telephony_slot_key* keys = slot->keys;
+	int ret = 0;
+	int i = 0;
+
+	if( slot->watch_ref_counts[watch] > 0 )
+	{
+		slot->watch_ref_counts[watch]++;
+		return NETWORK_INFO_ERROR_NONE;
+	}
+
+	for( i = 0; i < NETWORK_INFO_KEY_COUNT; i++ )
+	{
+		if( (watch_p->keys & NETWORK_INFO_KEY_BIT(i)) == 0 )
+		{
+			continue;
+		}
+
+		if( watch_p->is_notified_first == true )
+		{
+			ret = _network_info_backend_notify_key_changed_first(keys[i].info.key, watch_p->adapter, (void*)&keys[i]);
+		}
+		else
+		{
+			ret = _network_info_backend_notify_key_changed(keys[i].info.key, watch_p->adapter, (void*)&keys[i]);
+		}
+
+		if( ret != 0 )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback of %s", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, keys[i].info.key);
+			while( --i >= 0 )
+			{
+				if( (watch_p->keys & NETWORK_INFO_KEY_BIT(i)) != 0 )
+				{
+					_network_info_backend_ignore_key_changed(keys[i].info.key, watch_p->adapter, (void*)&keys[i]);
+				}
+			}
+			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+	}
+
+	slot->watch_ref_counts[watch] = 1;
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+// Must be called with network_info_lock held
+static int __unref_watch(telephony_slot* slot, telephony_watch_e watch)
+{
+	const telephony_watch* watch_p = &watches[watch];
+	telephony_slot_key* keys = slot->keys;
+	int ret = NETWORK_INFO_ERROR_NONE;
+	int i = 0;
+
+	if( slot->watch_ref_counts[watch] == 0 || --slot->watch_ref_counts[watch] > 0 )
+	{
+		return NETWORK_INFO_ERROR_NONE;
+	}
+
+	for( i = 0; i < NETWORK_INFO_KEY_COUNT; i++ )
+	{
+		if( (watch_p->keys & NETWORK_INFO_KEY_BIT(i)) != 0
+			&& _network_info_backend_ignore_key_changed(keys[i].info.key, watch_p->adapter, (void*)&keys[i]) != 0 )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to unregister callback of %s", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, keys[i].info.key);
+			ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+	}
+
+	return ret;
+}
+
+static int __add_subscription(network_info_h handle, network_info_event_e event, network_info_event_cb callback, void* user_data, network_info_subscription_h* subscription)
+{
+	telephony_event_data* event_p = &handle->event_data[event];
+	network_info_subscription_h subscription_p = NULL;
+	int value = 0;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	subscription_p = (network_info_subscription_h)calloc(1, sizeof(struct _network_info_subscription_s));
+	if( subscription_p == NULL )
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+		return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	// one watch is shared by all subscriptions of an event.
+	// It is registered before the current value is read, so that no change is lost in between.
+	if( event_p->subscriber_count == 0 )
+	{
+		ret = __register_event_watch(handle, event);
+		if( ret != NETWORK_INFO_ERROR_NONE )
+		{
+			free(subscription_p);
+			return ret;
+		}
+	}
+
+	ret = __get_event_value(handle, event, &value);
+	if( ret != NETWORK_INFO_ERROR_NONE )
+	{
+		LOGE("[%s] %s(0x%08x) : fail to get current value of event(%d)", __FUNCTION__, __convert_error_code_to_string(ret), ret, event);
+		if( event_p->subscriber_count == 0 )
+		{
+			__unregister_event_watch(handle, event);
+		}
+		free(subscription_p);
+		return ret;
+	}
+
+	if( event_p->subscriber_count == 0 )
+	{
+		event_p->previous_value = value;
+	}
+
+	subscription_p->handle = handle;
+	subscription_p->event = event;
+	subscription_p->callback = callback;
+	subscription_p->user_data = user_data;
+	subscription_p->link.data = subscription_p;
+	subscription_p->is_removed = false;
+	subscription_p->ref_count = 1;
+	g_queue_init(&subscription_p->queued_events);
+
+	g_queue_push_tail_link(&event_p->subscriptions, &subscription_p->link);
+	event_p->subscriber_count++;
+
+	*subscription = subscription_p;
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+static int __remove_subscription(network_info_subscription_h subscription)
+{
+	network_info_h handle = subscription->handle;
+	network_info_event_e event = subscription->event;
+	telephony_event_data* event_p = &handle->event_data[event];
+
+	subscription->is_removed = true;
+	event_p->subscriber_count--;
+
+	if( subscription->rssi_filter != NULL && subscription->rssi_filter->timer_id != 0 )
+	{
+		g_source_remove(subscription->rssi_filter->timer_id);
+		subscription->rssi_filter->timer_id = 0;
+	}
+
+	// the links are kept while dispatching, so that the dispatch can go on with the next link
+	if( event_p->dispatch_depth > 0 )
+	{
+		event_p->has_removed = true;
+	}
+	else
+	{
+		g_queue_unlink(&event_p->subscriptions, &subscription->link);
+		__unref_subscription(subscription);
+	}
+
+	if( event_p->subscriber_count == 0 )
 	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		return __unregister_event_watch(handle, event);
 	}
 
-	*provider_name = provider_name_p;
-
 	return NETWORK_INFO_ERROR_NONE;
 }
 
-
-int network_info_get_type(network_info_type_e* network_type)
+static void __purge_subscriptions(telephony_event_data* event)
 {
-	int service_type = 0;
-	int ret = NETWORK_INFO_ERROR_NONE;
-	
-	NETWORK_INFO_CHECK_INPUT_PARAMETER(network_type);
-	
-	ret = __check_service_state((char*)__FUNCTION__);
-	if( ret != NETWORK_INFO_ERROR_NONE )
-	{
-		return ret;
-	}
+	GList* link = event->subscriptions.head;
+	GList* next = NULL;
+	network_info_subscription_h subscription = NULL;
 
-	if( vconf_get_int(VCONFKEY_TELEPHONY_SVCTYPE, &service_type) != 0 )
+	while( link != NULL )
 	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		next = link->next;
+		subscription = (network_info_subscription_h)link->data;
+		if( subscription->is_removed == true )
+		{
+			g_queue_unlink(&event->subscriptions, link);
+			__unref_subscription(subscription);
+		}
+		link = next;
 	}
 
-	switch(service_type)
+	event->has_removed = false;
+}
+
+// Waits until the queued callback of the subscription returns, unless it is invoked in this thread
+static void __wait_for_delivery(network_info_subscription_h subscription)
+{
+	g_mutex_lock(&delivery_lock);
+
+	while( subscription->delivering_thread != NULL && subscription->delivering_thread != g_thread_self() )
 	{
-		case VCONFKEY_TELEPHONY_SVCTYPE_2G:
-			*network_type = NETWORK_INFO_TYPE_GSM;
-			break;
-		case VCONFKEY_TELEPHONY_SVCTYPE_2_5G:
-			*network_type = NETWORK_INFO_TYPE_GPRS;
-			break;
-		case VCONFKEY_TELEPHONY_SVCTYPE_2_5G_EDGE:
-			*network_type = NETWORK_INFO_TYPE_EDGE;
-			break;
-		case VCONFKEY_TELEPHONY_SVCTYPE_3G:
-			*network_type = NETWORK_INFO_TYPE_UMTS;;
-			break;
-		case VCONFKEY_TELEPHONY_SVCTYPE_HSDPA:
-			*network_type = NETWORK_INFO_TYPE_HSDPA;
-			break;
-		default:
-			*network_type = NETWORK_INFO_TYPE_UNKNOWN;
-			break;			
+		g_cond_wait(&delivery_cond, &delivery_lock);
 	}
 
-	return NETWORK_INFO_ERROR_NONE;
+	g_mutex_unlock(&delivery_lock);
 }
 
+static network_info_subscription_h __ref_subscription(network_info_subscription_h subscription)
+{
+	g_atomic_int_inc(&subscription->ref_count);
+	return subscription;
+}
 
-int network_info_get_service_state(network_info_service_state_e* network_service_state)
+static void __unref_subscription(network_info_subscription_h subscription)
 {
-	int service_type = 0;
-	int cs_status = 0;
-	int is_flight_mode = 0;
+	telephony_queued_event* queued_event = NULL;
 
-	NETWORK_INFO_CHECK_INPUT_PARAMETER(network_service_state);
-	
-	// get service type	
-	if( vconf_get_int(VCONFKEY_TELEPHONY_SVCTYPE, &service_type) != 0 )
+	if( g_atomic_int_dec_and_test(&subscription->ref_count) == FALSE )
 	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get service type", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		return;
 	}
 
-	if( service_type == VCONFKEY_TELEPHONY_SVCTYPE_EMERGENCY )
+	while( (queued_event = (telephony_queued_event*)g_queue_pop_head(&subscription->queued_events)) != NULL )
 	{
-		*network_service_state = NETWORK_INFO_SERVICE_STATE_EMERGENCY_ONLY;
-		return NETWORK_INFO_ERROR_NONE;
-	}	
+		free(queued_event);
+	}
 
-	// get circuit service	
-	if( vconf_get_int(VCONFKEY_TELEPHONY_SVC_CS, &cs_status) != 0 )
+	if( subscription->context != NULL )
 	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get the status of cs", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		g_main_context_unref(subscription->context);
 	}
 
-	if( cs_status == VCONFKEY_TELEPHONY_SVC_CS_ON )
-	{
-		*network_service_state = NETWORK_INFO_SERVICE_STATE_IN_SERVICE;
-		return NETWORK_INFO_ERROR_NONE;		
-	}	
+	free(subscription->rssi_filter);
+	free(subscription);
+}
+
+// Invokes the callback, or queues the event to the main context of the subscription
+static void __deliver_event(network_info_subscription_h subscription, network_info_event_e event, void* data)
+{
+	telephony_queued_event* queued_event = NULL;
+	GSource* source = NULL;
 
-	// get flight mode
-	if( vconf_get_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, &is_flight_mode) != 0 )
+	if( subscription->context == NULL )
 	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to get flight mode", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		__invoke_callback(subscription, event, data, _network_info_stats_begin());
+		return;
 	}
 
-	if( is_flight_mode == 1 )
+	queued_event = (telephony_queued_event*)calloc(1, sizeof(telephony_queued_event));
+	if( queued_event == NULL )
 	{
-		*network_service_state = NETWORK_INFO_SERVICE_STATE_RADIO_OFF;
-		return NETWORK_INFO_ERROR_NONE;	
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x) : event(%d) is lost", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY, event);
+		return;
 	}
 
-	*network_service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
-	return NETWORK_INFO_ERROR_NONE;
+	queued_event->event = event;
+	queued_event->dispatch_time = _network_info_stats_begin();
+	memcpy(&queued_event->value, data, __get_event_data_size(event));
+	g_queue_push_tail(&subscription->queued_events, queued_event);
+
+	// one delivery takes all the events queued until it runs
+	if( subscription->delivery_is_scheduled == false )
+	{
+		source = g_idle_source_new();
+		g_source_set_priority(source, G_PRIORITY_DEFAULT);
+		g_source_set_callback(source, __queued_event_cb, __ref_subscription(subscription), (GDestroyNotify)__unref_subscription);
+		g_source_attach(source, subscription->context);
+		g_source_unref(source);
+		subscription->delivery_is_scheduled = true;
+	}
 }
 
-int network_info_set_service_state_changed_cb(network_info_service_state_changed_cb callback, void* user_data)
+static void __invoke_callback(network_info_subscription_h subscription, network_info_event_e event, void* data, unsigned long long dispatch_time)
 {
-	int ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
-	network_info_service_state_e service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	unsigned long long begin = 0;
 
-	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+	_network_info_stats_delivery(dispatch_time);
 
-	ret = network_info_get_service_state(&service_state);
-	if( ret != NETWORK_INFO_ERROR_NONE )
+	begin = _network_info_stats_begin();
+
+	subscription->callback(event, data, subscription->user_data);
+
+	_network_info_stats_callback_end(begin);
+}
+
+static size_t __get_event_data_size(network_info_event_e event)
+{
+	switch(event)
 	{
-		LOGE("[%s] %s(0x%08x) : fail to get current service state", __FUNCTION__, __convert_error_code_to_string(ret), ret);
-		return ret;
+		case NETWORK_INFO_EVENT_SERVICE_STATE:
+			return sizeof(network_info_service_state_e);
+		case NETWORK_INFO_EVENT_CELL_ID:
+			return sizeof(int);
+		case NETWORK_INFO_EVENT_RSSI:
+			return sizeof(network_info_rssi_e);
+		case NETWORK_INFO_EVENT_ROAMING_STATE:
+			return sizeof(bool);
+		case NETWORK_INFO_EVENT_NETWORK_CHANGED:
+			return sizeof(network_info_change_s);
+		case NETWORK_INFO_EVENT_SERVING_CELL:
+			return sizeof(network_info_serving_cell_s);
+		case NETWORK_INFO_EVENT_PROVIDER_NAME:
+			return NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1;
+		case NETWORK_INFO_EVENT_TYPE:
+			return sizeof(network_info_type_e);
+		case NETWORK_INFO_EVENT_PLMN:
+			return sizeof(network_info_plmn_s);
+		default:
+			return 0;
 	}
+}
 
-	if( flight_mode_is_registered == false) 
+// The queued callbacks are invoked without network_info_lock, so that they do not delay the notifications
+static gboolean __queued_event_cb(gpointer user_data)
+{
+	network_info_subscription_h subscription = (network_info_subscription_h)user_data;
+	telephony_queued_event* queued_event = NULL;
+	bool is_removed = false;
+
+	while( true )
 	{
-		if( vconf_notify_key_changed(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, (vconf_callback_fn)__telephony_service_changed_cb_adapter, NULL) != 0 )
+		g_rec_mutex_lock(&network_info_lock);
+		queued_event = (telephony_queued_event*)g_queue_pop_head(&subscription->queued_events);
+		if( queued_event == NULL )
 		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback of flight mode", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			subscription->delivery_is_scheduled = false;
 		}
-		flight_mode_is_registered = true;		
-	}
+		is_removed = subscription->is_removed;
+		if( queued_event != NULL && is_removed == false )
+		{
+			// set before network_info_lock is released, so that network_info_unsubscribe() waits for the callback
+			g_mutex_lock(&delivery_lock);
+			subscription->delivering_thread = g_thread_self();
+			g_mutex_unlock(&delivery_lock);
+		}
+		g_rec_mutex_unlock(&network_info_lock);
 
-	if( svctype_is_registered == false )
-	{
-		if(vconf_notify_key_changed(VCONFKEY_TELEPHONY_SVCTYPE, (vconf_callback_fn)__telephony_service_changed_cb_adapter, NULL) != 0)
+		if( queued_event == NULL )
 		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback of service type", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			break;
 		}
-		svctype_is_registered = true;
-	}
 
-	if( svc_cs_is_registered == false )
-	{
-		if(vconf_notify_key_changed(VCONFKEY_TELEPHONY_SVC_CS, (vconf_callback_fn)__telephony_service_changed_cb_adapter, NULL) != 0)
+		if( is_removed == false )
 		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback of circuit service", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			__invoke_callback(subscription, queued_event->event, &queued_event->value, queued_event->dispatch_time);
+
+			g_mutex_lock(&delivery_lock);
+			subscription->delivering_thread = NULL;
+			g_cond_broadcast(&delivery_cond);
+			g_mutex_unlock(&delivery_lock);
 		}
-		svc_cs_is_registered = true;
+		free(queued_event);
 	}
 
-	service_state_cb.previous_value = service_state;
-	service_state_cb.cb = callback;
-	service_state_cb.user_data = user_data;
-
-	return NETWORK_INFO_ERROR_NONE;
+	return FALSE;
 }
 
-int network_info_unset_service_state_changed_cb()
+// Must be called with network_info_lock held
+static GMainContext* __get_dispatch_context()
 {
-	if( flight_mode_is_registered == true )
+	GMainContext* context = NULL;
+	GThread* thread = NULL;
+
+	if( dispatch_context != NULL )
 	{
-		if( vconf_ignore_key_changed(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, (vconf_callback_fn)__telephony_service_changed_cb_adapter) != 0 )
-		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to unregister callback of flight mode", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
-		}
-		flight_mode_is_registered = false;
+		return dispatch_context;
 	}
 
-	if( svctype_is_registered == true )
+	context = g_main_context_new();
+	thread = g_thread_try_new("network-info", __dispatch_thread_func, context, NULL);
+	if( thread == NULL )
 	{
-		if(vconf_ignore_key_changed(VCONFKEY_TELEPHONY_SVCTYPE, (vconf_callback_fn)__telephony_service_changed_cb_adapter) != 0)
-		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to unregister callback of service type", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
-		}
-		svctype_is_registered = false;
+		g_main_context_unref(context);
+		return NULL;
 	}
 
-	if( svc_cs_is_registered == true )
-	{
-		if(vconf_ignore_key_changed(VCONFKEY_TELEPHONY_SVC_CS, (vconf_callback_fn)__telephony_service_changed_cb_adapter) != 0)
-		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to unregister callback of circuit service", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
-		}
-		svc_cs_is_registered = false;
-	}	
+	// the thread runs as long as the process
+	g_thread_unref(thread);
+	dispatch_context = context;
+
+	return dispatch_context;
+}
+
+static gpointer __dispatch_thread_func(gpointer data)
+{
+	GMainContext* context = (GMainContext*)data;
+	GMainLoop* loop = g_main_loop_new(context, FALSE);
 
-	service_state_cb.previous_value = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
-	service_state_cb.cb = NULL;
-	service_state_cb.user_data = NULL;
+	g_main_context_push_thread_default(context);
+	g_main_loop_run(loop);
 
-	return NETWORK_INFO_ERROR_NONE;	
+	return NULL;
 }
 
+// Handles destroyed while the callbacks of the slot are invoked are freed when the outermost dispatch ends
+static void __begin_dispatch(telephony_slot* slot)
+{
+	slot->dispatch_depth++;
+	dispatch_depth++;
+}
 
-int network_info_set_cell_id_changed_cb(network_info_cell_id_changed_cb callback, void* user_data)
+static void __end_dispatch(telephony_slot* slot)
 {
-	int cell_id = 0;
-	int ret = NETWORK_INFO_ERROR_NONE;
+	GList* link = NULL;
+	GList* next = NULL;
+	network_info_h handle = NULL;
 
-	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+	slot->dispatch_depth--;
+	dispatch_depth--;
 
-	ret = network_info_get_cell_id(&cell_id);
-	if( ret != NETWORK_INFO_ERROR_NONE )
+	if( slot->dispatch_depth > 0 || slot->has_destroyed == false )
 	{
-		LOGE("[%s] %s(0x%08x) : fail to get current CELL ID", __FUNCTION__, __convert_error_code_to_string(ret), ret);
-		return ret;
+		return;
 	}
 
-	if( cell_id_is_registered == false) 
-	{		
-		if( vconf_notify_key_changed(VCONFKEY_TELEPHONY_CELLID, (vconf_callback_fn)__cell_id_changed_cb_adapter, NULL) != 0 )
+	for( link = slot->handles.head; link != NULL; link = next )
+	{
+		next = link->next;
+		handle = (network_info_h)link->data;
+		if( handle->is_destroyed == true )
 		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback function", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			__free_handle(handle);
 		}
-
-		cell_id_is_registered = true;		
 	}
 
-	cell_id_cb.previous_value = cell_id;
-	cell_id_cb.cb = callback;
-	cell_id_cb.user_data = user_data;
+	slot->has_destroyed = false;
+}
+
+// Each handle of the slot compares the value with the one it delivered last
+static void __dispatch_event(telephony_slot* slot, network_info_event_e event, int value, void* data)
+{
+	telephony_event_data* event_p = NULL;
+	network_info_h handle = NULL;
+	GList* link = NULL;
+	unsigned int crossed_rssi_thresholds = 0;
 
-	return NETWORK_INFO_ERROR_NONE;
+	__begin_dispatch(slot);
+	for( link = slot->handles.head; link != NULL; link = link->next )
+	{
+		handle = (network_info_h)link->data;
+		if( handle->is_destroyed == true )
+		{
+			continue;
+		}
+
+		event_p = &handle->event_data[event];
+		if( value == event_p->previous_value )
+		{
+			_network_info_stats_suppressed();
+			continue;
+		}
+
+		// found once here, and each subscription only tests its own thresholds against them
+		if( event == NETWORK_INFO_EVENT_RSSI )
+		{
+			crossed_rssi_thresholds = __get_crossed_rssi_thresholds(event_p->previous_value, value);
+		}
+		event_p->previous_value = value;
+
+		__notify_subscriptions(handle, event, value, data, crossed_rssi_thresholds);
+	}
+	__end_dispatch(slot);
 }
 
-int network_info_unset_cell_id_changed_cb()
+// Must be called between __begin_dispatch() and __end_dispatch() of the slot of the handle.
+// crossed_rssi_thresholds are the thresholds crossed by an RSSI change, in the same bits as rssi_thresholds, and 0 for the other events.
+static void __notify_subscriptions(network_info_h handle, network_info_event_e event, int value, void* data, unsigned int crossed_rssi_thresholds)
 {
-	if( cell_id_is_registered == true )
+	telephony_event_data* event_p = &handle->event_data[event];
+	GList* link = NULL;
+	network_info_subscription_h subscription = NULL;
+
+	event_p->dispatch_depth++;
+	for( link = event_p->subscriptions.head; link != NULL; link = link->next )
 	{
-		if( vconf_ignore_key_changed(VCONFKEY_TELEPHONY_CELLID, (vconf_callback_fn)__cell_id_changed_cb_adapter) != 0 )
+		subscription = (network_info_subscription_h)link->data;
+		if( subscription->is_removed == true )
 		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to unregister callback function", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			continue;
+		}
+
+		// the change stays in the same band of the subscription
+		if( subscription->rssi_thresholds != 0 && (subscription->rssi_thresholds & crossed_rssi_thresholds) == 0 )
+		{
+			continue;
 		}
 
-		cell_id_is_registered = false;
-		cell_id_cb.previous_value = 0;
-		cell_id_cb.cb = NULL;
-		cell_id_cb.user_data = NULL;		
+		if( subscription->rssi_filter != NULL )
+		{
+			__filter_rssi(subscription, value);
+		}
+		else
+		{
+			__deliver_event(subscription, event, data);
+		}
 	}
+	event_p->dispatch_depth--;
 
-	return NETWORK_INFO_ERROR_NONE;	
+	if( event_p->dispatch_depth == 0 && event_p->has_removed == true )
+	{
+		__purge_subscriptions(event_p);
+	}
 }
 
-int network_info_set_rssi_changed_cb(network_info_rssi_changed_cb callback, void* user_data)
+static int __set_legacy_cb(network_info_h handle, network_info_event_e event, const void* callback, void* user_data)
 {
-	network_info_rssi_e rssi = NETWORK_INFO_RSSI_0;
+	telephony_cb_data* cb_data = &handle->legacy_cb_data[event];
 	int ret = NETWORK_INFO_ERROR_NONE;
 
-	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+	g_rec_mutex_lock(&network_info_lock);
 
-	ret = network_info_get_rssi(&rssi);
-	if( ret != NETWORK_INFO_ERROR_NONE )
+	if( cb_data->subscription == NULL )
 	{
-		LOGE("[%s] %s(0x%08x) : fail to get current RSSI", __FUNCTION__, __convert_error_code_to_string(ret), ret);
-		return ret;
+		ret = __add_subscription(handle, event, __legacy_cb_adapter, cb_data, &cb_data->subscription);
 	}
 
-	if( rssi_is_registered == false) 
-	{		
-		if( vconf_notify_key_changed(VCONFKEY_TELEPHONY_RSSI, (vconf_callback_fn)__rssi_changed_cb_adapter, NULL) != 0 )
-		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback function", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
-		}
-
-		rssi_is_registered = true;		
+	if( ret == NETWORK_INFO_ERROR_NONE )
+	{
+		cb_data->cb = callback;
+		cb_data->user_data = user_data;
 	}
 
-	rssi_cb.previous_value = rssi;
-	rssi_cb.cb = callback;
-	rssi_cb.user_data = user_data;
+	g_rec_mutex_unlock(&network_info_lock);
 
-	return NETWORK_INFO_ERROR_NONE;
+	return ret;
 }
 
-int network_info_unset_rssi_changed_cb()
+static int __unset_legacy_cb(network_info_h handle, network_info_event_e event)
 {
-	if( rssi_is_registered == true )
-	{
-		if( vconf_ignore_key_changed(VCONFKEY_TELEPHONY_RSSI, (vconf_callback_fn)__rssi_changed_cb_adapter) != 0 )
-		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to unregister callback function", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
-		}
+	telephony_cb_data* cb_data = &handle->legacy_cb_data[event];
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	g_rec_mutex_lock(&network_info_lock);
 
-		rssi_is_registered = false;
-		rssi_cb.previous_value = NETWORK_INFO_RSSI_0;
-		rssi_cb.cb = NULL;
-		rssi_cb.user_data = NULL;		
+	if( cb_data->subscription != NULL )
+	{
+		ret = __remove_subscription(cb_data->subscription);
+		cb_data->subscription = NULL;
 	}
 
-	return NETWORK_INFO_ERROR_NONE;	
+	cb_data->cb = NULL;
+	cb_data->user_data = NULL;
+
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return ret;
 }
 
-int network_info_set_roaming_state_changed_cb(network_info_roaming_state_changed_cb callback, void* user_data)
+static int __set_rssi_thresholds(network_info_subscription_h subscription, const network_info_rssi_e* thresholds, int count)
 {
-	bool is_roaming = false;
-	int ret = NETWORK_INFO_ERROR_NONE;
+	unsigned int rssi_thresholds = 0;
+	int i = 0;
 
-	NETWORK_INFO_CHECK_INPUT_PARAMETER(callback);
+	if( subscription->event != NETWORK_INFO_EVENT_RSSI || subscription->is_removed == true )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : not a subscription of RSSI", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
 
-	ret = network_info_is_roaming(&is_roaming);
-	if( ret != NETWORK_INFO_ERROR_NONE )
+	if( thresholds != NULL && count <= 0 )
 	{
-		LOGE("[%s] %s(0x%08x) : fail to get current roaming state", __FUNCTION__, __convert_error_code_to_string(ret), ret);
-		return ret;
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : count(%d)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER, count);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
 	}
 
-	if( roaming_is_registered == false) 
-	{		
-		if( vconf_notify_key_changed(VCONFKEY_TELEPHONY_SVC_ROAM, (vconf_callback_fn)__roaming_changed_cb_adapter, NULL) != 0 )
+	for( i = 0; thresholds != NULL && i < count; i++ )
+	{
+		if( thresholds[i] <= NETWORK_INFO_RSSI_0 || thresholds[i] > NETWORK_INFO_RSSI_6 )
 		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback function", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+			LOGE("[%s] INVALID_PARAMETER(0x%08x) : threshold(%d)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER, thresholds[i]);
+			return NETWORK_INFO_ERROR_INVALID_PARAMETER;
 		}
-
-		roaming_is_registered = true;		
+		rssi_thresholds |= 1u << thresholds[i];
 	}
 
-	roaming_cb.previous_value = is_roaming;
-	roaming_cb.cb = callback;
-	roaming_cb.user_data = user_data;
+	subscription->rssi_thresholds = rssi_thresholds;
 
-	return NETWORK_INFO_ERROR_NONE;	
+	return NETWORK_INFO_ERROR_NONE;
 }
 
-int network_info_unset_roaming_state_changed_cb()
+// Returns the thresholds t with old_rssi < t <= new_rssi or new_rssi < t <= old_rssi
+static unsigned int __get_crossed_rssi_thresholds(int old_rssi, int new_rssi)
 {
-	if( roaming_is_registered == true )
-	{
-		if( vconf_ignore_key_changed(VCONFKEY_TELEPHONY_SVC_ROAM, (vconf_callback_fn)__roaming_changed_cb_adapter) != 0 )
-		{
-			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to unregister callback function", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
-			return NETWORK_INFO_ERROR_OPERATION_FAILED;
-		}
+	int low = MIN(old_rssi, new_rssi);
+	int high = MAX(old_rssi, new_rssi);
 
-		roaming_is_registered = false;
-		roaming_cb.previous_value = false;
-		roaming_cb.cb = NULL;
-		roaming_cb.user_data = NULL;		
-	}
+	low = CLAMP(low, NETWORK_INFO_RSSI_0, NETWORK_INFO_RSSI_6);
+	high = CLAMP(high, NETWORK_INFO_RSSI_0, NETWORK_INFO_RSSI_6);
 
-	return NETWORK_INFO_ERROR_NONE;	
+	return ((2u << high) - 1) & ~((2u << low) - 1);
 }
 
-static void __telephony_service_changed_cb_adapter(keynode_t *node, void* user_data) 
+static int __set_rssi_policy(network_info_subscription_h subscription, const network_info_rssi_policy_s* policy)
 {
-	network_info_service_state_e status = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	telephony_rssi_filter* filter = NULL;
 
-	if( service_state_cb.cb == NULL )
+	if( subscription->event != NETWORK_INFO_EVENT_RSSI || subscription->is_removed == true )
 	{
-		return;
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : not a subscription of RSSI", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
 	}
 
-	if( network_info_get_service_state(&status) == NETWORK_INFO_ERROR_NONE )
+	filter = subscription->rssi_filter;
+
+	if( policy == NULL )
 	{
-		if( status != service_state_cb.previous_value )
+		if( filter != NULL )
 		{
-			((network_info_service_state_changed_cb)(service_state_cb.cb))(status, service_state_cb.user_data);
-			service_state_cb.previous_value = status;			
+			if( filter->timer_id != 0 )
+			{
+				g_source_remove(filter->timer_id);
+			}
+			free(filter);
+			subscription->rssi_filter = NULL;
 		}
+		return NETWORK_INFO_ERROR_NONE;
 	}
-}
-
-static void __cell_id_changed_cb_adapter(keynode_t *node, void* user_data) 
-{
-	int cell_id = 0;
 
-	if( cell_id_cb.cb == NULL )
+	if( filter == NULL )
 	{
-		LOGI("[%s] There is no registered callback", __FUNCTION__);
-		return;
+		filter = (telephony_rssi_filter*)calloc(1, sizeof(telephony_rssi_filter));
+		if( filter == NULL )
+		{
+			LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+			return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+		}
+
+		// the subscriber has already seen the current value
+		filter->delivered_value = subscription->handle->event_data[NETWORK_INFO_EVENT_RSSI].previous_value;
+		filter->pending_value = filter->delivered_value;
+		subscription->rssi_filter = filter;
 	}
 
-	if( network_info_get_cell_id(&cell_id) == NETWORK_INFO_ERROR_NONE )
+	filter->policy = *policy;
+
+	// a pending value is delivered according to the new policy in the main loop
+	if( filter->pending_value != filter->delivered_value )
 	{
-		if( cell_id != cell_id_cb.previous_value )
+		if( filter->timer_id != 0 )
 		{
-			LOGI("[%s] network_info_cell_id_changed_cb will be called", __FUNCTION__);
-			((network_info_cell_id_changed_cb)(cell_id_cb.cb))(cell_id, cell_id_cb.user_data);
-			cell_id_cb.previous_value = cell_id;			
+			g_source_remove(filter->timer_id);
 		}
+		filter->timer_id = g_timeout_add_full(G_PRIORITY_DEFAULT, 0, __rssi_filter_timeout_cb, __ref_subscription(subscription), (GDestroyNotify)__unref_subscription);
 	}
+
+	return NETWORK_INFO_ERROR_NONE;
 }
 
-static void __rssi_changed_cb_adapter(keynode_t *node, void* user_data) 
+static void __filter_rssi(network_info_subscription_h subscription, int rssi)
 {
-	network_info_rssi_e rssi = 0;
+	telephony_rssi_filter* filter = subscription->rssi_filter;
 
-	if( rssi_cb.cb == NULL )
+	if( rssi != filter->pending_value )
 	{
-		return;
+		filter->pending_value = rssi;
+		filter->pending_since = g_get_monotonic_time();
 	}
 
-	if( network_info_get_rssi(&rssi) == NETWORK_INFO_ERROR_NONE )
-	{
-		if( rssi != rssi_cb.previous_value )
-		{
-			((network_info_rssi_changed_cb)(rssi_cb.cb))(rssi, rssi_cb.user_data);
-			rssi_cb.previous_value = rssi;			
-		}
-	}
+	__evaluate_rssi_filter(subscription);
 }
 
-static void __roaming_changed_cb_adapter(keynode_t *node, void* user_data) 
+// Delivers the pending value if the policy allows it, otherwise waits until it does.
+// Must be called while dispatching, because the callback may remove the subscription.
+static void __evaluate_rssi_filter(network_info_subscription_h subscription)
 {
-	bool is_roaming = 0;
+	telephony_rssi_filter* filter = subscription->rssi_filter;
+	network_info_rssi_e rssi = filter->pending_value;
+	gint64 now = g_get_monotonic_time();
+	gint64 due_time = now;
+
+	if( filter->timer_id != 0 )
+	{
+		g_source_remove(filter->timer_id);
+		filter->timer_id = 0;
+	}
 
-	if( roaming_cb.cb == NULL )
+	// the level came back before it was delivered
+	if( filter->pending_value == filter->delivered_value )
 	{
 		return;
 	}
 
-	if( network_info_is_roaming(&is_roaming) == NETWORK_INFO_ERROR_NONE )
+	// a small change has to be kept for hold_time, a big one is delivered without waiting
+	if( filter->policy.min_delta <= 0 || ABS(filter->pending_value - filter->delivered_value) < filter->policy.min_delta )
 	{
-		if( is_roaming != roaming_cb.previous_value )
+		if( filter->policy.hold_time > 0 )
+		{
+			due_time = filter->pending_since + (gint64)filter->policy.hold_time * 1000;
+		}
+		else if( filter->policy.min_delta > 0 )
 		{
-			((network_info_roaming_state_changed_cb)(roaming_cb.cb))(is_roaming, roaming_cb.user_data);
-			roaming_cb.previous_value = is_roaming;			
+			// without hold_time, a small change waits until the level moves by min_delta
+			return;
 		}
 	}
-}
 
+	if( filter->policy.min_interval > 0 && filter->delivered_time > 0 )
+	{
+		due_time = MAX(due_time, filter->delivered_time + (gint64)filter->policy.min_interval * 1000);
+	}
 
-static char* __convert_error_code_to_string(network_info_error_e error_code)
-{
-	switch(error_code)
+	// the last value is delivered when the timer expires, so it is never lost
+	if( due_time > now )
 	{
-		case NETWORK_INFO_ERROR_OUT_OF_MEMORY:
-			return "OUT_OF_MEMORY";
-		case NETWORK_INFO_ERROR_INVALID_PARAMETER:
-			return "INVALID_PARAMETER";
-		case NETWORK_INFO_ERROR_OPERATION_FAILED:
-			return "OPERATION_FAILED";
-		case NETWORK_INFO_ERROR_OUT_OF_SERVICE:
-			return "OUT_OF_SERVICE";
-		default:
-			return "UNKNOWN";
+		filter->timer_id = g_timeout_add_full(G_PRIORITY_DEFAULT, (due_time - now + 999) / 1000, __rssi_filter_timeout_cb, __ref_subscription(subscription), (GDestroyNotify)__unref_subscription);
+		return;
 	}
+
+	filter->delivered_value = filter->pending_value;
+	filter->delivered_time = now;
+
+	__deliver_event(subscription, NETWORK_INFO_EVENT_RSSI, &rssi);
 }
 
-static int __check_service_state(char* function_name)
+static gboolean __rssi_filter_timeout_cb(gpointer user_data)
 {
-	network_info_service_state_e service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	network_info_subscription_h subscription = (network_info_subscription_h)user_data;
+	network_info_h handle = NULL;
+	telephony_event_data* event_p = NULL;
+
+	g_rec_mutex_lock(&network_info_lock);
 
-	if( network_info_get_service_state(&service_state) != NETWORK_INFO_ERROR_NONE )
+	// the subscription is kept by the timer, but it may be removed or its policy may be unset in another thread.
+	// The handle is valid while the subscription is not removed.
+	if( subscription->is_removed == true || subscription->rssi_filter == NULL )
 	{
-		LOGE("[%s] OPERATION_FAILED(0x%08x)", function_name, NETWORK_INFO_ERROR_OPERATION_FAILED);
-		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		g_rec_mutex_unlock(&network_info_lock);
+		return FALSE;
 	}
 
-	if( service_state != NETWORK_INFO_SERVICE_STATE_IN_SERVICE )
+	subscription->rssi_filter->timer_id = 0;
+
+	handle = subscription->handle;
+	event_p = &handle->event_data[NETWORK_INFO_EVENT_RSSI];
+
+	__begin_dispatch(handle->slot);
+	event_p->dispatch_depth++;
+	__evaluate_rssi_filter(subscription);
+	event_p->dispatch_depth--;
+
+	if( event_p->dispatch_depth == 0 && event_p->has_removed == true )
 	{
-		LOGE("[%s] OUT_OF_SERVICE(0x%08x)", function_name, NETWORK_INFO_ERROR_OUT_OF_SERVICE);
-		return NETWORK_INFO_ERROR_OUT_OF_SERVICE;
+		__purge_subscriptions(event_p);
 	}
+	__end_dispatch(handle->slot);
 
-	return NETWORK_INFO_ERROR_NONE;
+	g_rec_mutex_unlock(&network_info_lock);
+
+	return FALSE;
 }
 
+static unsigned int __compare_snapshot(const network_info_snapshot_s* old_snapshot, const network_info_snapshot_s* new_snapshot)
+{
+	unsigned int changed_fields = 0;
 
+	if( old_snapshot->service_state != new_snapshot->service_state )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_SERVICE_STATE;
+	}
+	if( old_snapshot->network_type != new_snapshot->network_type )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_NETWORK_TYPE;
+	}
+	if( old_snapshot->lac != new_snapshot->lac )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_LAC;
+	}
+	if( old_snapshot->cell_id != new_snapshot->cell_id )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_CELL_ID;
+	}
+	if( old_snapshot->rssi != new_snapshot->rssi )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_RSSI;
+	}
+	if( old_snapshot->is_roaming != new_snapshot->is_roaming )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_ROAMING_STATE;
+	}
+	if( strcmp(old_snapshot->mcc, new_snapshot->mcc) != 0 || strcmp(old_snapshot->mnc, new_snapshot->mnc) != 0 )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_PLMN;
+	}
+	if( strcmp(old_snapshot->provider_name, new_snapshot->provider_name) != 0 )
+	{
+		changed_fields |= NETWORK_INFO_FIELD_PROVIDER_NAME;
+	}
 
+	return changed_fields;
+}
@@ -0,0 +1,745 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <telephony_network_backend_private.h>
+#include <telephony_network_private.h>
+#include <vconf.h>
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_NETWORK_INFO"
+
+typedef struct _telephony_key_watch
+{
+	char* key;
+	telephony_key_changed_cb callback;
+	void* user_data;
+	bool is_first;	// notified before the other callbacks of the key
+	bool is_removed;
+} telephony_key_watch;
+
+// Callbacks of the watched keys, changed with _network_info_lock() held
+static GList* key_watches = NULL;
+static int notify_depth = 0;
+static bool watch_is_removed = false;	// whether watches are removed during the notification
+
+typedef struct _telephony_memory_key
+{
+	char* key;
+	int type;
+	int int_value;
+	char* str_value;
+} telephony_memory_key;
+
+// Keys of the in-memory backend
+static GList* memory_keys = NULL;
+static GMutex memory_lock;
+
+// vconf backend
+static int __vconf_get_int(const char* key, int* value);
+static int __vconf_get_bool(const char* key, int* value);
+static char* __vconf_get_str(const char* key);
+static int __vconf_read_keys(const telephony_key_info* keys, int count, void* values);
+static int __vconf_watch_key(const char* key);
+static int __vconf_unwatch_key(const char* key);
+static void __vconf_key_changed_cb(keynode_t* node, void* user_data);
+
+// in-memory backend
+static int __memory_get_int(const char* key, int* value);
+static int __memory_get_bool(const char* key, int* value);
+static char* __memory_get_str(const char* key);
+static int __memory_read_keys(const telephony_key_info* keys, int count, void* values);
+static int __memory_watch_key(const char* key);
+static int __memory_unwatch_key(const char* key);
+static telephony_memory_key* __memory_find_key(const char* key);
+static int __memory_get_value(const char* key, int type, int* value);
+static int __memory_set_value(const char* key, int type, int int_value, const char* str_value);
+
+static const telephony_backend* __get_backend();
+static int __add_key_watch(const char* key, telephony_key_changed_cb callback, void* user_data, bool is_first);
+static int __count_key_watches(const char* key);
+static void __purge_key_watches();
+static void __free_key_watch(telephony_key_watch* watch);
+
+static const telephony_backend vconf_backend =
+{
+	__vconf_get_int,
+	__vconf_get_bool,
+	__vconf_get_str,
+	__vconf_read_keys,
+	__vconf_watch_key,
+	__vconf_unwatch_key
+};
+
+static const telephony_backend memory_backend =
+{
+	__memory_get_int,
+	__memory_get_bool,
+	__memory_get_str,
+	__memory_read_keys,
+	__memory_watch_key,
+	__memory_unwatch_key
+};
+
+// Read by the getters without any lock
+static const telephony_backend* current_backend = &vconf_backend;
+
+// The number of reads made from the backend, updated without any lock
+static unsigned long long read_count = 0;
+
+
+int network_info_set_backend(network_info_backend_e backend)
+{
+	const telephony_backend* new_backend = NULL;
+	int ret = NETWORK_INFO_ERROR_NONE;
+
+	switch(backend)
+	{
+		case NETWORK_INFO_BACKEND_VCONF:
+			new_backend = &vconf_backend;
+			break;
+		case NETWORK_INFO_BACKEND_MEMORY:
+			new_backend = &memory_backend;
+			break;
+		default:
+			LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid backend(%d)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER, backend);
+			return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	_network_info_lock();
+
+	// the watches of the previous backend would never be notified
+	if( key_watches != NULL )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : keys are already watched", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		ret = NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+	else
+	{
+		g_atomic_pointer_set(&current_backend, new_backend);
+	}
+
+	_network_info_unlock();
+
+	return ret;
+}
+
+int network_info_memory_backend_set_int(const char* key, int value)
+{
+	if( key == NULL )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return __memory_set_value(key, VCONF_TYPE_INT, value, NULL);
+}
+
+int network_info_memory_backend_set_bool(const char* key, bool value)
+{
+	if( key == NULL )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return __memory_set_value(key, VCONF_TYPE_BOOL, value, NULL);
+}
+
+int network_info_memory_backend_set_str(const char* key, const char* value)
+{
+	if( key == NULL || value == NULL )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return __memory_set_value(key, VCONF_TYPE_STRING, 0, value);
+}
+
+int network_info_backend_get_read_count(unsigned long long* count)
+{
+	if( count == NULL )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	*count = __atomic_load_n(&read_count, __ATOMIC_RELAXED);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_backend_reset_read_count()
+{
+	__atomic_store_n(&read_count, 0, __ATOMIC_RELAXED);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int _network_info_backend_get_int(const char* key, int* value)
+{
+	__atomic_fetch_add(&read_count, 1, __ATOMIC_RELAXED);
+	return __get_backend()->get_int(key, value);
+}
+
+int _network_info_backend_get_bool(const char* key, int* value)
+{
+	__atomic_fetch_add(&read_count, 1, __ATOMIC_RELAXED);
+	return __get_backend()->get_bool(key, value);
+}
+
+char* _network_info_backend_get_str(const char* key)
+{
+	__atomic_fetch_add(&read_count, 1, __ATOMIC_RELAXED);
+	return __get_backend()->get_str(key);
+}
+
+int _network_info_backend_read_keys(const telephony_key_info* keys, int count, void* values)
+{
+	__atomic_fetch_add(&read_count, 1, __ATOMIC_RELAXED);
+	return __get_backend()->read_keys(keys, count, values);
+}
+
+void _network_info_copy_str(char* buffer, size_t buffer_size, const char* value)
+{
+	size_t length = strlen(value);
+
+	if( length >= buffer_size )
+	{
+		length = buffer_size - 1;
+
+		// step back to the first byte of the character which is cut
+		while( length > 0 && ((unsigned char)value[length] & 0xC0) == 0x80 )
+		{
+			length--;
+		}
+	}
+
+	memcpy(buffer, value, length);
+	memset(buffer + length, 0x00, buffer_size - length);
+}
+
+// A cut never removes more than the first 3 bytes of a character of at most 4 bytes
+bool _network_info_str_may_be_cut(const char* buffer, size_t buffer_size)
+{
+	return strlen(buffer) + 4 > buffer_size;
+}
+
+int _network_info_backend_notify_key_changed(const char* key, telephony_key_changed_cb callback, void* user_data)
+{
+	return __add_key_watch(key, callback, user_data, false);
+}
+
+int _network_info_backend_notify_key_changed_first(const char* key, telephony_key_changed_cb callback, void* user_data)
+{
+	return __add_key_watch(key, callback, user_data, true);
+}
+
+int _network_info_backend_ignore_key_changed(const char* key, telephony_key_changed_cb callback, void* user_data)
+{
+	GList* link = NULL;
+	telephony_key_watch* watch = NULL;
+	int ret = -1;
+
+	_network_info_lock();
+
+	for( link = key_watches; link != NULL; link = link->next )
+	{
+		watch = (telephony_key_watch*)link->data;
+		if( watch->is_removed == false && watch->callback == callback && watch->user_data == user_data && strcmp(watch->key, key) == 0 )
+		{
+			break;
+		}
+	}
+
+	if( link != NULL )
+	{
+		// the links are kept while notifying, so that the notification can go on with the next link
+		if( notify_depth > 0 )
+		{
+			watch->is_removed = true;
+			watch_is_removed = true;
+		}
+		else
+		{
+			key_watches = g_list_delete_link(key_watches, link);
+			__free_key_watch(watch);
+		}
+
+		ret = 0;
+		if( __count_key_watches(key) == 0 )
+		{
+			ret = __get_backend()->unwatch_key(key);
+		}
+	}
+
+	_network_info_unlock();
+
+	return ret;
+}
+
+void _network_info_backend_key_changed(const char* key, const telephony_key_value* value)
+{
+	GList* link = NULL;
+	telephony_key_watch* watch = NULL;
+
+	_network_info_stats_notification();
+
+	_network_info_lock();
+
+	notify_depth++;
+	for( link = key_watches; link != NULL; link = link->next )
+	{
+		watch = (telephony_key_watch*)link->data;
+		if( watch->is_removed == false && strcmp(watch->key, key) == 0 )
+		{
+			watch->callback(key, value, watch->user_data);
+		}
+	}
+	notify_depth--;
+
+	if( notify_depth == 0 && watch_is_removed == true )
+	{
+		__purge_key_watches();
+	}
+
+	_network_info_unlock();
+}
+
+bool _network_info_backend_is_memory()
+{
+	return __get_backend() == &memory_backend;
+}
+
+// __memory_set_value() notifies the change itself
+int _network_info_backend_replay_key_changed(const char* key, const telephony_key_value* value)
+{
+	if( _network_info_backend_is_memory() == false )
+	{
+		return -1;
+	}
+
+	return __memory_set_value(key, value->type, value->int_value, value->type == VCONF_TYPE_STRING ? value->str_value : NULL) == NETWORK_INFO_ERROR_NONE ? 0 : -1;
+}
+
+static const telephony_backend* __get_backend()
+{
+	return (const telephony_backend*)g_atomic_pointer_get(&current_backend);
+}
+
+static int __add_key_watch(const char* key, telephony_key_changed_cb callback, void* user_data, bool is_first)
+{
+	telephony_key_watch* watch = NULL;
+	GList* link = NULL;
+	int ret = 0;
+
+	watch = (telephony_key_watch*)calloc(1, sizeof(telephony_key_watch));
+	if( watch == NULL )
+	{
+		return -1;
+	}
+
+	watch->key = strdup(key);
+	if( watch->key == NULL )
+	{
+		free(watch);
+		return -1;
+	}
+	watch->callback = callback;
+	watch->user_data = user_data;
+	watch->is_first = is_first;
+
+	_network_info_lock();
+
+	// one backend watch is shared by all callbacks of the key
+	if( __count_key_watches(key) == 0 )
+	{
+		ret = __get_backend()->watch_key(key);
+	}
+
+	// the callbacks notified first are kept before the others
+	if( ret == 0 && is_first == true )
+	{
+		link = key_watches;
+		while( link != NULL && ((telephony_key_watch*)link->data)->is_first == true )
+		{
+			link = link->next;
+		}
+		key_watches = g_list_insert_before(key_watches, link, watch);
+	}
+	else if( ret == 0 )
+	{
+		key_watches = g_list_append(key_watches, watch);
+	}
+	else
+	{
+		__free_key_watch(watch);
+	}
+
+	_network_info_unlock();
+
+	return ret;
+}
+
+static int __count_key_watches(const char* key)
+{
+	GList* link = NULL;
+	telephony_key_watch* watch = NULL;
+	int count = 0;
+
+	for( link = key_watches; link != NULL; link = link->next )
+	{
+		watch = (telephony_key_watch*)link->data;
+		if( watch->is_removed == false && strcmp(watch->key, key) == 0 )
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static void __purge_key_watches()
+{
+	GList* link = key_watches;
+	GList* next = NULL;
+	telephony_key_watch* watch = NULL;
+
+	while( link != NULL )
+	{
+		next = link->next;
+		watch = (telephony_key_watch*)link->data;
+		if( watch->is_removed == true )
+		{
+			key_watches = g_list_delete_link(key_watches, link);
+			__free_key_watch(watch);
+		}
+		link = next;
+	}
+
+	watch_is_removed = false;
+}
+
+static void __free_key_watch(telephony_key_watch* watch)
+{
+	free(watch->key);
+	free(watch);
+}
+
+static int __vconf_get_int(const char* key, int* value)
+{
+	return vconf_get_int(key, value);
+}
+
+static int __vconf_get_bool(const char* key, int* value)
+{
+	return vconf_get_bool(key, value);
+}
+
+static char* __vconf_get_str(const char* key)
+{
+	return vconf_get_str(key);
+}
+
+// Reads all keys with one vconf request
+static int __vconf_read_keys(const telephony_key_info* keys, int count, void* values)
+{
+	keylist_t* keylist = NULL;
+	keynode_t* node = NULL;
+	char* value_p = NULL;
+	int type = 0;
+	int ret = 0;
+	int i = 0;
+
+	keylist = vconf_keylist_new();
+	if( keylist == NULL )
+	{
+		return -1;
+	}
+
+	for( i = 0; i < count; i++ )
+	{
+		if( vconf_keylist_add_null(keylist, keys[i].key) < 0 )
+		{
+			vconf_keylist_free(keylist);
+			return -1;
+		}
+	}
+
+	if( vconf_get(keylist, "", VCONF_GET_KEY) != 0 )
+	{
+		vconf_keylist_free(keylist);
+		return -1;
+	}
+
+	for( i = 0; i < count && ret == 0; i++ )
+	{
+		value_p = (char*)values + keys[i].offset;
+
+		// the field of the value is sized for the type of the key
+		type = vconf_keylist_lookup(keylist, keys[i].key, &node);
+		if( type != keys[i].type )
+		{
+			ret = -1;
+			break;
+		}
+
+		switch( type )
+		{
+			case VCONF_TYPE_INT:
+				*(int*)value_p = vconf_keynode_get_int(node);
+				break;
+			case VCONF_TYPE_BOOL:
+				*(int*)value_p = vconf_keynode_get_bool(node);
+				break;
+			case VCONF_TYPE_STRING:
+				if( vconf_keynode_get_str(node) == NULL )
+				{
+					ret = -1;
+					break;
+				}
+				_network_info_copy_str(value_p, NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1, vconf_keynode_get_str(node));
+				break;
+			default:
+				ret = -1;
+				break;
+		}
+	}
+
+	vconf_keylist_free(keylist);
+
+	return ret;
+}
+
+static int __vconf_watch_key(const char* key)
+{
+	return vconf_notify_key_changed(key, __vconf_key_changed_cb, NULL);
+}
+
+static int __vconf_unwatch_key(const char* key)
+{
+	return vconf_ignore_key_changed(key, __vconf_key_changed_cb);
+}
+
+static void __vconf_key_changed_cb(keynode_t* node, void* user_data)
+{
+	telephony_key_value value;
+
+	memset(&value, 0x00, sizeof(telephony_key_value));
+	value.type = vconf_keynode_get_type(node);
+
+	switch(value.type)
+	{
+		case VCONF_TYPE_INT:
+			value.int_value = vconf_keynode_get_int(node);
+			break;
+		case VCONF_TYPE_BOOL:
+			value.int_value = vconf_keynode_get_bool(node);
+			break;
+		case VCONF_TYPE_STRING:
+			value.str_value = vconf_keynode_get_str(node);
+			break;
+		default:
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : unknown type(%d) of %s", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, value.type, vconf_keynode_get_name(node));
+			return;
+	}
+
+	_network_info_backend_key_changed(vconf_keynode_get_name(node), &value);
+}
+
+static int __memory_get_int(const char* key, int* value)
+{
+	return __memory_get_value(key, VCONF_TYPE_INT, value);
+}
+
+static int __memory_get_bool(const char* key, int* value)
+{
+	return __memory_get_value(key, VCONF_TYPE_BOOL, value);
+}
+
+static char* __memory_get_str(const char* key)
+{
+	telephony_memory_key* memory_key = NULL;
+	char* value = NULL;
+
+	g_mutex_lock(&memory_lock);
+
+	memory_key = __memory_find_key(key);
+	if( memory_key != NULL && memory_key->type == VCONF_TYPE_STRING )
+	{
+		value = strdup(memory_key->str_value);
+	}
+
+	g_mutex_unlock(&memory_lock);
+
+	return value;
+}
+
+static int __memory_read_keys(const telephony_key_info* keys, int count, void* values)
+{
+	telephony_memory_key* memory_key = NULL;
+	char* value_p = NULL;
+	int ret = 0;
+	int i = 0;
+
+	g_mutex_lock(&memory_lock);
+
+	for( i = 0; i < count && ret == 0; i++ )
+	{
+		value_p = (char*)values + keys[i].offset;
+
+		memory_key = __memory_find_key(keys[i].key);
+		if( memory_key == NULL || memory_key->type != keys[i].type )
+		{
+			ret = -1;
+		}
+		else if( memory_key->type == VCONF_TYPE_STRING )
+		{
+			_network_info_copy_str(value_p, NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1, memory_key->str_value);
+		}
+		else
+		{
+			*(int*)value_p = memory_key->int_value;
+		}
+	}
+
+	g_mutex_unlock(&memory_lock);
+
+	return ret;
+}
+
+// The changes are notified by __memory_set_value(), whether the key is watched or not
+static int __memory_watch_key(const char* key)
+{
+	return 0;
+}
+
+static int __memory_unwatch_key(const char* key)
+{
+	return 0;
+}
+
+// Must be called with memory_lock held
+static telephony_memory_key* __memory_find_key(const char* key)
+{
+	GList* link = NULL;
+	telephony_memory_key* memory_key = NULL;
+
+	for( link = memory_keys; link != NULL; link = link->next )
+	{
+		memory_key = (telephony_memory_key*)link->data;
+		if( strcmp(memory_key->key, key) == 0 )
+		{
+			return memory_key;
+		}
+	}
+
+	return NULL;
+}
+
+static int __memory_get_value(const char* key, int type, int* value)
+{
+	telephony_memory_key* memory_key = NULL;
+	int ret = -1;
+
+	g_mutex_lock(&memory_lock);
+
+	memory_key = __memory_find_key(key);
+	if( memory_key != NULL && memory_key->type == type )
+	{
+		*value = memory_key->int_value;
+		ret = 0;
+	}
+
+	g_mutex_unlock(&memory_lock);
+
+	return ret;
+}
+
+static int __memory_set_value(const char* key, int type, int int_value, const char* str_value)
+{
+	telephony_memory_key* memory_key = NULL;
+	telephony_key_value value;
+	char* str = NULL;
+
+	if( str_value != NULL )
+	{
+		str = strdup(str_value);
+		if( str == NULL )
+		{
+			LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+			return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	g_mutex_lock(&memory_lock);
+
+	memory_key = __memory_find_key(key);
+	if( memory_key == NULL )
+	{
+		memory_key = (telephony_memory_key*)calloc(1, sizeof(telephony_memory_key));
+		if( memory_key != NULL )
+		{
+			memory_key->key = strdup(key);
+			if( memory_key->key == NULL )
+			{
+				free(memory_key);
+				memory_key = NULL;
+			}
+			else
+			{
+				memory_keys = g_list_prepend(memory_keys, memory_key);
+			}
+		}
+	}
+
+	if( memory_key == NULL )
+	{
+		g_mutex_unlock(&memory_lock);
+		free(str);
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+		return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	free(memory_key->str_value);
+	memory_key->type = type;
+	memory_key->int_value = int_value;
+	memory_key->str_value = str;
+
+	g_mutex_unlock(&memory_lock);
+
+	if( __get_backend() != &memory_backend )
+	{
+		return NETWORK_INFO_ERROR_NONE;
+	}
+
+	// the value is passed as it was set, so it does not change while being notified
+	memset(&value, 0x00, sizeof(telephony_key_value));
+	value.type = type;
+	value.int_value = int_value;
+	value.str_value = str_value;
+
+	_network_info_backend_key_changed(key, &value);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
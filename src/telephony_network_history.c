@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <telephony_network.h>
+#include <telephony_network_private.h>
+#include <string.h>
+#include <glib.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_NETWORK_INFO"
+
+#define NETWORK_INFO_HISTORY_SIZE 256
+
+typedef struct _telephony_history_slot
+{
+	unsigned long long sequence;	// sequence of entry, 0 while entry is being written
+	network_info_history_entry_s entry;
+} telephony_history_slot;
+
+// Change n is kept in history[n % NETWORK_INFO_HISTORY_SIZE] until change n + NETWORK_INFO_HISTORY_SIZE overwrites it.
+// The writers are serialized by _network_info_lock(), and the readers take no lock.
+static telephony_history_slot history[NETWORK_INFO_HISTORY_SIZE];
+static unsigned long long last_sequence = 0;
+
+static bool __read_slot(unsigned long long sequence, network_info_history_entry_s* entry);
+
+
+int network_info_get_recent_history(network_info_history_entry_s* entries, int max_count, int* count)
+{
+	unsigned long long last = 0;
+	unsigned long long sequence = 0;
+
+	if( entries == NULL || count == NULL || max_count < 0 )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	last = __atomic_load_n(&last_sequence, __ATOMIC_ACQUIRE);
+	sequence = last - MIN(last, (unsigned long long)MIN(max_count, NETWORK_INFO_HISTORY_SIZE));
+
+	*count = 0;
+	while( ++sequence <= last )
+	{
+		// the changes overwritten while being copied are skipped
+		if( __read_slot(sequence, &entries[*count]) == true )
+		{
+			(*count)++;
+		}
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_get_history_since(unsigned long long sequence, network_info_history_entry_s* entries, int max_count, int* count, unsigned long long* lost_count)
+{
+	unsigned long long last = 0;
+	unsigned long long oldest = 0;
+
+	if( entries == NULL || count == NULL || lost_count == NULL || max_count < 0 )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	last = __atomic_load_n(&last_sequence, __ATOMIC_ACQUIRE);
+	oldest = (last > NETWORK_INFO_HISTORY_SIZE) ? last - NETWORK_INFO_HISTORY_SIZE + 1 : 1;
+
+	*count = 0;
+	*lost_count = 0;
+
+	if( sequence + 1 < oldest )
+	{
+		*lost_count = oldest - (sequence + 1);
+		sequence = oldest - 1;
+	}
+
+	while( *count < max_count && ++sequence <= last )
+	{
+		if( __read_slot(sequence, &entries[*count]) == true )
+		{
+			(*count)++;
+		}
+		else
+		{
+			(*lost_count)++;
+		}
+	}
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+void _network_info_history_add(int slot_index, network_info_history_type_e type, int value)
+{
+	unsigned long long sequence = last_sequence + 1;
+	telephony_history_slot* slot = &history[sequence % NETWORK_INFO_HISTORY_SIZE];
+
+	__atomic_store_n(&slot->sequence, 0, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	slot->entry.sequence = sequence;
+	slot->entry.timestamp = g_get_monotonic_time();
+	slot->entry.slot = slot_index;
+	slot->entry.type = type;
+	slot->entry.value = value;
+
+	__atomic_store_n(&slot->sequence, sequence, __ATOMIC_RELEASE);
+	__atomic_store_n(&last_sequence, sequence, __ATOMIC_RELEASE);
+}
+
+// Returns false if the change has been overwritten
+static bool __read_slot(unsigned long long sequence, network_info_history_entry_s* entry)
+{
+	telephony_history_slot* slot = &history[sequence % NETWORK_INFO_HISTORY_SIZE];
+
+	if( __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != sequence )
+	{
+		return false;
+	}
+
+	memcpy(entry, &slot->entry, sizeof(network_info_history_entry_s));
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+	return (__atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) == sequence);
+}
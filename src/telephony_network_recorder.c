@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <telephony_network_recorder.h>
+#include <telephony_network_backend_private.h>
+#include <telephony_network_private.h>
+#include <vconf.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_NETWORK_INFO"
+
+// The log starts with NETWORK_INFO_LOG_MAGIC, followed by the records.
+// A record is a header of NETWORK_INFO_LOG_HEADER_SIZE bytes in little endian:
+//   4 bytes : milliseconds since the previous record
+//   1 byte  : index of the key in the keys of _network_info_get_keys()
+//   1 byte  : telephony_log_type_e
+//   2 bytes : the size of the value
+// and the value, which is a 4-byte integer or a string without the terminating null.
+#define NETWORK_INFO_LOG_MAGIC "NILG"
+#define NETWORK_INFO_LOG_MAGIC_SIZE 4
+#define NETWORK_INFO_LOG_HEADER_SIZE 8
+
+typedef enum
+{
+	NETWORK_INFO_LOG_TYPE_INT = 0x00,
+	NETWORK_INFO_LOG_TYPE_BOOL,
+	NETWORK_INFO_LOG_TYPE_STRING
+} telephony_log_type_e;
+
+// Log being recorded, changed with _network_info_lock() held
+static FILE* record_file = NULL;
+static gint64 record_time = 0;	// time of the previous record in microseconds
+
+typedef struct _telephony_replay
+{
+	gchar* data;
+	gsize length;
+	gsize offset;	// offset of the next record
+	unsigned int speed;
+	guint timer_id;
+	network_info_replay_finished_cb callback;
+	void* user_data;
+} telephony_replay;
+
+// Replay in progress, NULL if there is none. Changed with _network_info_lock() held.
+static telephony_replay* replay = NULL;
+
+static void __recorder_key_changed_cb(const char* key, const telephony_key_value* value, void* user_data);
+static void __stop_recording();
+static int __write_record(int key_index, const telephony_key_value* value);
+static int __read_record(const telephony_replay* replay_p, gsize offset, int* key_index, telephony_key_value* value, unsigned int* delay, gsize* next_offset);
+static void __schedule_replay(telephony_replay* replay_p, unsigned int delay);
+static gboolean __replay_timeout_cb(gpointer user_data);
+static void __free_replay(telephony_replay* replay_p);
+static void __put_uint16(unsigned char* buffer, unsigned int value);
+static void __put_uint32(unsigned char* buffer, unsigned int value);
+static unsigned int __get_uint16(const unsigned char* buffer);
+static unsigned int __get_uint32(const unsigned char* buffer);
+
+
+int network_info_start_recording(const char* path)
+{
+	const telephony_key_info* keys = NULL;
+	FILE* file = NULL;
+	int key_count = 0;
+	int i = 0;
+
+	if( path == NULL )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	_network_info_lock();
+
+	if( record_file != NULL )
+	{
+		_network_info_unlock();
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : already recording", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	// the log is only appended, so a crash loses at most the record being written
+	file = fopen(path, "ab");
+	if( file == NULL || fseek(file, 0, SEEK_END) != 0
+		|| (ftell(file) == 0 && fwrite(NETWORK_INFO_LOG_MAGIC, NETWORK_INFO_LOG_MAGIC_SIZE, 1, file) != 1) )
+	{
+		if( file != NULL )
+		{
+			fclose(file);
+		}
+		_network_info_unlock();
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to open %s", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, path);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	keys = _network_info_get_keys(&key_count);
+	for( i = 0; i < key_count; i++ )
+	{
+		if( _network_info_backend_notify_key_changed(keys[i].key, __recorder_key_changed_cb, GINT_TO_POINTER(i)) != 0 )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to register callback of %s", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, keys[i].key);
+			while( --i >= 0 )
+			{
+				_network_info_backend_ignore_key_changed(keys[i].key, __recorder_key_changed_cb, GINT_TO_POINTER(i));
+			}
+			fclose(file);
+			_network_info_unlock();
+			return NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+	}
+
+	record_file = file;
+	record_time = g_get_monotonic_time();
+
+	_network_info_unlock();
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_stop_recording()
+{
+	_network_info_lock();
+
+	if( record_file == NULL )
+	{
+		_network_info_unlock();
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : not recording", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	__stop_recording();
+
+	_network_info_unlock();
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_start_replay(const char* path, unsigned int speed, network_info_replay_finished_cb callback, void* user_data)
+{
+	telephony_replay* replay_p = NULL;
+
+	if( path == NULL )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	// the getters of the other backends would not return the replayed values
+	if( _network_info_backend_is_memory() == false )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : the in-memory backend is not used", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	replay_p = (telephony_replay*)calloc(1, sizeof(telephony_replay));
+	if( replay_p == NULL )
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_OUT_OF_MEMORY);
+		return NETWORK_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	if( g_file_get_contents(path, &replay_p->data, &replay_p->length, NULL) == FALSE
+		|| replay_p->length < NETWORK_INFO_LOG_MAGIC_SIZE
+		|| memcmp(replay_p->data, NETWORK_INFO_LOG_MAGIC, NETWORK_INFO_LOG_MAGIC_SIZE) != 0 )
+	{
+		__free_replay(replay_p);
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to read %s", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, path);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	replay_p->offset = NETWORK_INFO_LOG_MAGIC_SIZE;
+	replay_p->speed = speed;
+	replay_p->callback = callback;
+	replay_p->user_data = user_data;
+
+	_network_info_lock();
+
+	if( replay != NULL )
+	{
+		_network_info_unlock();
+		__free_replay(replay_p);
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : replay in progress", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	replay = replay_p;
+	__schedule_replay(replay_p, 0);
+
+	_network_info_unlock();
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_stop_replay()
+{
+	_network_info_lock();
+
+	if( replay == NULL )
+	{
+		_network_info_unlock();
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : no replay in progress", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		return NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+
+	// timer_id is 0 if a callback of a replayed change stops the replay
+	if( replay->timer_id != 0 )
+	{
+		g_source_remove(replay->timer_id);
+	}
+	__free_replay(replay);
+	replay = NULL;
+
+	_network_info_unlock();
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+static void __recorder_key_changed_cb(const char* key, const telephony_key_value* value, void* user_data)
+{
+	_network_info_lock();
+
+	// a log which misses a change would replay wrong values, so the recording stops at the first failure
+	if( record_file != NULL && __write_record(GPOINTER_TO_INT(user_data), value) != 0 )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to write record, recording stopped", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED);
+		__stop_recording();
+	}
+
+	_network_info_unlock();
+}
+
+// Must be called with _network_info_lock() held
+static void __stop_recording()
+{
+	const telephony_key_info* keys = NULL;
+	int key_count = 0;
+	int i = 0;
+
+	keys = _network_info_get_keys(&key_count);
+	for( i = 0; i < key_count; i++ )
+	{
+		_network_info_backend_ignore_key_changed(keys[i].key, __recorder_key_changed_cb, GINT_TO_POINTER(i));
+	}
+
+	fclose(record_file);
+	record_file = NULL;
+}
+
+// Must be called with _network_info_lock() held. Returns -1 if the record is not written in full.
+static int __write_record(int key_index, const telephony_key_value* value)
+{
+	unsigned char header[NETWORK_INFO_LOG_HEADER_SIZE];
+	unsigned char int_value[4];
+	gint64 now = g_get_monotonic_time();
+	unsigned int elapsed = (unsigned int)MIN((now - record_time) / 1000, G_MAXUINT32);
+	size_t size = 0;
+
+	// the time is counted from the previous record, so that the rounding errors do not add up
+	record_time += (gint64)elapsed * 1000;
+
+	header[4] = key_index;
+	__put_uint32(header, elapsed);
+
+	switch(value->type)
+	{
+		case VCONF_TYPE_STRING:
+			size = value->str_value != NULL ? MIN(strlen(value->str_value), G_MAXUINT16) : 0;
+			header[5] = NETWORK_INFO_LOG_TYPE_STRING;
+			__put_uint16(header + 6, size);
+			if( fwrite(header, sizeof(header), 1, record_file) != 1
+				|| (size > 0 && fwrite(value->str_value, size, 1, record_file) != 1) )
+			{
+				return -1;
+			}
+			break;
+		default:
+			header[5] = value->type == VCONF_TYPE_BOOL ? NETWORK_INFO_LOG_TYPE_BOOL : NETWORK_INFO_LOG_TYPE_INT;
+			__put_uint16(header + 6, sizeof(int_value));
+			__put_uint32(int_value, (unsigned int)value->int_value);
+			if( fwrite(header, sizeof(header), 1, record_file) != 1
+				|| fwrite(int_value, sizeof(int_value), 1, record_file) != 1 )
+			{
+				return -1;
+			}
+			break;
+	}
+
+	return fflush(record_file) == 0 ? 0 : -1;
+}
+
+// Reads the record at offset. The string value points to a copy which must be released with g_free().
+static int __read_record(const telephony_replay* replay_p, gsize offset, int* key_index, telephony_key_value* value, unsigned int* delay, gsize* next_offset)
+{
+	const unsigned char* header = (const unsigned char*)replay_p->data + offset;
+	unsigned int size = 0;
+	int key_count = 0;
+
+	if( replay_p->length - offset < NETWORK_INFO_LOG_HEADER_SIZE )
+	{
+		return -1;
+	}
+
+	_network_info_get_keys(&key_count);
+	size = __get_uint16(header + 6);
+	if( replay_p->length - offset - NETWORK_INFO_LOG_HEADER_SIZE < size || header[4] >= key_count )
+	{
+		return -1;
+	}
+
+	memset(value, 0x00, sizeof(telephony_key_value));
+	switch(header[5])
+	{
+		case NETWORK_INFO_LOG_TYPE_STRING:
+			value->type = VCONF_TYPE_STRING;
+			value->str_value = g_strndup((const gchar*)header + NETWORK_INFO_LOG_HEADER_SIZE, size);
+			break;
+		case NETWORK_INFO_LOG_TYPE_INT:
+		case NETWORK_INFO_LOG_TYPE_BOOL:
+			if( size != 4 )
+			{
+				return -1;
+			}
+			value->type = header[5] == NETWORK_INFO_LOG_TYPE_BOOL ? VCONF_TYPE_BOOL : VCONF_TYPE_INT;
+			value->int_value = (int)__get_uint32(header + NETWORK_INFO_LOG_HEADER_SIZE);
+			break;
+		default:
+			return -1;
+	}
+
+	*key_index = header[4];
+	*delay = __get_uint32(header);
+	*next_offset = offset + NETWORK_INFO_LOG_HEADER_SIZE + size;
+
+	return 0;
+}
+
+// Must be called with _network_info_lock() held
+static void __schedule_replay(telephony_replay* replay_p, unsigned int delay)
+{
+	if( replay_p->speed == 0 )
+	{
+		delay = 0;
+	}
+	else
+	{
+		delay /= replay_p->speed;
+	}
+
+	// the idle sources scheduled by a change run before the next change, as they would on the device
+	replay_p->timer_id = g_timeout_add_full(G_PRIORITY_LOW, delay, __replay_timeout_cb, replay_p, NULL);
+}
+
+static gboolean __replay_timeout_cb(gpointer user_data)
+{
+	telephony_replay* replay_p = (telephony_replay*)user_data;
+	network_info_replay_finished_cb callback = NULL;
+	void* callback_user_data = NULL;
+	const telephony_key_info* keys = NULL;
+	telephony_key_value value;
+	int key_count = 0;
+	int key_index = 0;
+	unsigned int delay = 0;
+	gsize next_offset = 0;
+	int result = NETWORK_INFO_ERROR_NONE;
+
+	_network_info_lock();
+
+	// the replay may be stopped in another thread while this callback was waiting for the lock
+	if( replay != replay_p )
+	{
+		_network_info_unlock();
+		return FALSE;
+	}
+
+	replay_p->timer_id = 0;
+
+	if( __read_record(replay_p, replay_p->offset, &key_index, &value, &delay, &next_offset) != 0 )
+	{
+		LOGE("[%s] OPERATION_FAILED(0x%08x) : broken record at %u", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, (unsigned int)replay_p->offset);
+		result = NETWORK_INFO_ERROR_OPERATION_FAILED;
+	}
+	else
+	{
+		replay_p->offset = next_offset;
+
+		// the backend may be changed after the replay started
+		keys = _network_info_get_keys(&key_count);
+		if( _network_info_backend_replay_key_changed(keys[key_index].key, &value) != 0 )
+		{
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : fail to set %s", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, keys[key_index].key);
+			result = NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+		g_free((gchar*)value.str_value);
+
+		// a callback of the change may stop the replay
+		if( replay != replay_p )
+		{
+			_network_info_unlock();
+			return FALSE;
+		}
+
+		if( result == NETWORK_INFO_ERROR_NONE && replay_p->offset < replay_p->length )
+		{
+			if( __read_record(replay_p, replay_p->offset, &key_index, &value, &delay, &next_offset) == 0 )
+			{
+				g_free((gchar*)value.str_value);
+				__schedule_replay(replay_p, delay);
+				_network_info_unlock();
+				return FALSE;
+			}
+
+			LOGE("[%s] OPERATION_FAILED(0x%08x) : broken record at %u", __FUNCTION__, NETWORK_INFO_ERROR_OPERATION_FAILED, (unsigned int)replay_p->offset);
+			result = NETWORK_INFO_ERROR_OPERATION_FAILED;
+		}
+	}
+
+	callback = replay_p->callback;
+	callback_user_data = replay_p->user_data;
+	__free_replay(replay_p);
+	replay = NULL;
+
+	_network_info_unlock();
+
+	if( callback != NULL )
+	{
+		callback(result, callback_user_data);
+	}
+
+	return FALSE;
+}
+
+static void __free_replay(telephony_replay* replay_p)
+{
+	g_free(replay_p->data);
+	free(replay_p);
+}
+
+static void __put_uint16(unsigned char* buffer, unsigned int value)
+{
+	buffer[0] = value & 0xff;
+	buffer[1] = (value >> 8) & 0xff;
+}
+
+static void __put_uint32(unsigned char* buffer, unsigned int value)
+{
+	__put_uint16(buffer, value & 0xffff);
+	__put_uint16(buffer + 2, value >> 16);
+}
+
+static unsigned int __get_uint16(const unsigned char* buffer)
+{
+	return buffer[0] | (buffer[1] << 8);
+}
+
+static unsigned int __get_uint32(const unsigned char* buffer)
+{
+	return __get_uint16(buffer) | (__get_uint16(buffer + 2) << 16);
+}
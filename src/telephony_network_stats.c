@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <telephony_network.h>
+#include <telephony_network_backend_private.h>
+#include <telephony_network_private.h>
+#include <string.h>
+#include <time.h>
+#include <glib.h>
+#include <dlog.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+#define LOG_TAG "TIZEN_N_NETWORK_INFO"
+
+// Counters updated with relaxed atomic operations, so that counting can be always on.
+// All members are unsigned long long, so the counters are copied one by one as an array.
+static network_info_stats_s stats;
+
+#define NETWORK_INFO_STATS_COUNTER_COUNT (sizeof(network_info_stats_s) / sizeof(unsigned long long))
+
+static void __count(unsigned long long* counter);
+static void __count_latency(unsigned long long* histogram, unsigned long long begin);
+
+
+int network_info_get_stats(network_info_stats_s* stats_out)
+{
+	unsigned long long* counters = (unsigned long long*)&stats;
+	unsigned long long* counters_out = (unsigned long long*)stats_out;
+	int i = 0;
+
+	if( stats_out == NULL )
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, NETWORK_INFO_ERROR_INVALID_PARAMETER);
+		return NETWORK_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	for( i = 0; i < NETWORK_INFO_STATS_COUNTER_COUNT; i++ )
+	{
+		counters_out[i] = __atomic_load_n(&counters[i], __ATOMIC_RELAXED);
+	}
+
+	// the reads are counted by the backend layer
+	network_info_backend_get_read_count(&stats_out->backend_read_count);
+
+	return NETWORK_INFO_ERROR_NONE;
+}
+
+int network_info_reset_stats()
+{
+	unsigned long long* counters = (unsigned long long*)&stats;
+	int i = 0;
+
+	for( i = 0; i < NETWORK_INFO_STATS_COUNTER_COUNT; i++ )
+	{
+		__atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+	}
+
+	return network_info_backend_reset_read_count();
+}
+
+unsigned long long _network_info_stats_begin()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+int _network_info_stats_end(network_info_api_e api, unsigned long long begin, int ret)
+{
+	network_info_api_stats_s* api_stats = &stats.apis[api];
+
+	__count(&api_stats->call_count);
+
+	switch(ret)
+	{
+		case NETWORK_INFO_ERROR_NONE:
+			break;
+		case NETWORK_INFO_ERROR_OUT_OF_MEMORY:
+			__count(&api_stats->out_of_memory_count);
+			break;
+		case NETWORK_INFO_ERROR_INVALID_PARAMETER:
+			__count(&api_stats->invalid_parameter_count);
+			break;
+		case NETWORK_INFO_ERROR_OUT_OF_SERVICE:
+			__count(&api_stats->out_of_service_count);
+			break;
+		default:
+			__count(&api_stats->operation_failed_count);
+			break;
+	}
+
+	__count_latency(api_stats->latency, begin);
+
+	return ret;
+}
+
+void _network_info_stats_callback_end(unsigned long long begin)
+{
+	__count(&stats.callback_count);
+	__count_latency(stats.callback_latency, begin);
+}
+
+void _network_info_stats_delivery(unsigned long long dispatch_time)
+{
+	__count_latency(stats.delivery_latency, dispatch_time);
+}
+
+void _network_info_stats_notification()
+{
+	__count(&stats.notification_count);
+}
+
+void _network_info_stats_suppressed()
+{
+	__count(&stats.suppressed_count);
+}
+
+static void __count(unsigned long long* counter)
+{
+	__atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+}
+
+static void __count_latency(unsigned long long* histogram, unsigned long long begin)
+{
+	unsigned long long latency = _network_info_stats_begin() - begin;
+	int bucket = 0;
+
+	// bucket is floor(log2(latency))
+	if( latency > 0 )
+	{
+		bucket = 63 - __builtin_clzll(latency);
+	}
+
+	__count(&histogram[MIN(bucket, NETWORK_INFO_STATS_LATENCY_BUCKET_COUNT - 1)]);
+}
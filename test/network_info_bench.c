@@ -0,0 +1,590 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Measures the getters and the key change notifications on the in-memory backend.
+// For each getter, prints the time and the throughput of a call, and the backend reads and the heap allocations made by a call,
+// without and with the cache.
+// For each network_info_set_*_changed_cb(), prints the time from the change of the key to the callback function,
+// and the heap allocations made by a notification.
+// Fails if a call or a notification makes more heap allocations than allowed by the bench tables.
+//
+// Usage: network-info-bench [calls per getter] [changes per callback function]
+
+#define _GNU_SOURCE
+#include "network_info_test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dlfcn.h>
+#include <glib.h>
+
+// The heap allocations are counted by wrapping the allocator of the process, which is found with dlsym(RTLD_NEXT).
+// strdup() and the other functions returning memory to be released with free() allocate it with malloc().
+typedef struct _bench_allocator
+{
+	void* (*malloc)(size_t size);
+	void* (*calloc)(size_t count, size_t size);
+	void* (*realloc)(void* ptr, size_t size);
+	void (*free)(void* ptr);
+	int (*posix_memalign)(void** ptr, size_t alignment, size_t size);
+	void* (*aligned_alloc)(size_t alignment, size_t size);
+	void* (*memalign)(size_t alignment, size_t size);
+	void* (*valloc)(size_t size);
+} bench_allocator;
+
+static bench_allocator allocator;
+static bool allocator_is_being_found = false;
+
+// Serves the allocations made by dlsym() while the allocator is being found. They are never released.
+#define BENCH_BOOTSTRAP_HEAP_SIZE 8192
+static char bootstrap_heap[BENCH_BOOTSTRAP_HEAP_SIZE] __attribute__((aligned(16)));
+static size_t bootstrap_heap_used = 0;
+
+static volatile gint alloc_count = 0;
+
+// The first allocation is made before any thread is created, so the allocator is found in one thread
+static bool __find_allocator()
+{
+	if( allocator.malloc != NULL )
+	{
+		return true;
+	}
+
+	if( allocator_is_being_found == true )
+	{
+		return false;
+	}
+
+	allocator_is_being_found = true;
+	allocator.malloc = dlsym(RTLD_NEXT, "malloc");
+	allocator.calloc = dlsym(RTLD_NEXT, "calloc");
+	allocator.realloc = dlsym(RTLD_NEXT, "realloc");
+	allocator.free = dlsym(RTLD_NEXT, "free");
+	allocator.posix_memalign = dlsym(RTLD_NEXT, "posix_memalign");
+	allocator.aligned_alloc = dlsym(RTLD_NEXT, "aligned_alloc");
+	allocator.memalign = dlsym(RTLD_NEXT, "memalign");
+	allocator.valloc = dlsym(RTLD_NEXT, "valloc");
+	allocator_is_being_found = false;
+
+	if( allocator.malloc == NULL || allocator.calloc == NULL || allocator.realloc == NULL || allocator.free == NULL )
+	{
+		abort();
+	}
+
+	return true;
+}
+
+static void* __bootstrap_alloc(size_t size)
+{
+	void* ptr = NULL;
+
+	size = (size + 15) & ~(size_t)15;
+	if( bootstrap_heap_used + size > BENCH_BOOTSTRAP_HEAP_SIZE )
+	{
+		return NULL;
+	}
+
+	ptr = bootstrap_heap + bootstrap_heap_used;
+	bootstrap_heap_used += size;
+	memset(ptr, 0x00, size);
+
+	return ptr;
+}
+
+static bool __is_bootstrap_alloc(void* ptr)
+{
+	return (char*)ptr >= bootstrap_heap && (char*)ptr < bootstrap_heap + BENCH_BOOTSTRAP_HEAP_SIZE;
+}
+
+void* malloc(size_t size)
+{
+	if( __find_allocator() == false )
+	{
+		return __bootstrap_alloc(size);
+	}
+
+	g_atomic_int_inc(&alloc_count);
+	return allocator.malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+	if( __find_allocator() == false )
+	{
+		return __bootstrap_alloc(count * size);
+	}
+
+	g_atomic_int_inc(&alloc_count);
+	return allocator.calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+	void* new_ptr = NULL;
+
+	if( __find_allocator() == false )
+	{
+		return NULL;
+	}
+
+	g_atomic_int_inc(&alloc_count);
+
+	// the size of a bootstrap allocation is not kept, so as much as may belong to it is copied
+	if( __is_bootstrap_alloc(ptr) == true )
+	{
+		new_ptr = allocator.malloc(size);
+		if( new_ptr != NULL )
+		{
+			memcpy(new_ptr, ptr, MIN(size, (size_t)(bootstrap_heap + BENCH_BOOTSTRAP_HEAP_SIZE - (char*)ptr)));
+		}
+		return new_ptr;
+	}
+
+	return allocator.realloc(ptr, size);
+}
+
+void free(void* ptr)
+{
+	if( ptr == NULL || __is_bootstrap_alloc(ptr) == true || __find_allocator() == false )
+	{
+		return;
+	}
+
+	allocator.free(ptr);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size)
+{
+	if( __find_allocator() == false || allocator.posix_memalign == NULL )
+	{
+		return ENOMEM;
+	}
+
+	g_atomic_int_inc(&alloc_count);
+	return allocator.posix_memalign(ptr, alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size)
+{
+	if( __find_allocator() == false || allocator.aligned_alloc == NULL )
+	{
+		return NULL;
+	}
+
+	g_atomic_int_inc(&alloc_count);
+	return allocator.aligned_alloc(alignment, size);
+}
+
+void* memalign(size_t alignment, size_t size)
+{
+	if( __find_allocator() == false || allocator.memalign == NULL )
+	{
+		return NULL;
+	}
+
+	g_atomic_int_inc(&alloc_count);
+	return allocator.memalign(alignment, size);
+}
+
+void* valloc(size_t size)
+{
+	if( __find_allocator() == false || allocator.valloc == NULL )
+	{
+		return NULL;
+	}
+
+	g_atomic_int_inc(&alloc_count);
+	return allocator.valloc(size);
+}
+
+typedef struct _bench_getter
+{
+	const char* name;
+	int (*call)();
+	int max_alloc_count;	// heap allocations allowed per call, for the returned string
+} bench_getter;
+
+static int __get_lac()
+{
+	int lac = 0;
+	return network_info_get_lac(&lac);
+}
+
+static int __get_cell_id()
+{
+	int cell_id = 0;
+	return network_info_get_cell_id(&cell_id);
+}
+
+static int __get_rssi()
+{
+	network_info_rssi_e rssi = NETWORK_INFO_RSSI_0;
+	return network_info_get_rssi(&rssi);
+}
+
+static int __get_mcc()
+{
+	char* mcc = NULL;
+	int ret = network_info_get_mcc(&mcc);
+	free(mcc);
+	return ret;
+}
+
+static int __get_mnc()
+{
+	char* mnc = NULL;
+	int ret = network_info_get_mnc(&mnc);
+	free(mnc);
+	return ret;
+}
+
+static int __get_provider_name()
+{
+	char* provider_name = NULL;
+	int ret = network_info_get_provider_name(&provider_name);
+	free(provider_name);
+	return ret;
+}
+
+static int __get_type()
+{
+	network_info_type_e network_type = NETWORK_INFO_TYPE_UNKNOWN;
+	return network_info_get_type(&network_type);
+}
+
+static int __get_service_state()
+{
+	network_info_service_state_e service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	return network_info_get_service_state(&service_state);
+}
+
+static int __is_roaming()
+{
+	bool is_roaming = false;
+	return network_info_is_roaming(&is_roaming);
+}
+
+static const bench_getter getters[] =
+{
+	{"lac", __get_lac, 0},
+	{"cell_id", __get_cell_id, 0},
+	{"rssi", __get_rssi, 0},
+	{"mcc", __get_mcc, 1},
+	{"mnc", __get_mnc, 1},
+	{"provider_name", __get_provider_name, 1},
+	{"type", __get_type, 0},
+	{"service_state", __get_service_state, 0},
+	{"is_roaming", __is_roaming, 0}
+};
+
+// Time of the last callback, in nanoseconds of network_info_test_get_time()
+static long long notified_time = 0;
+
+static void __notified()
+{
+	notified_time = network_info_test_get_time();
+}
+
+static void __cell_id_changed_cb(int cell_id, void* user_data)
+{
+	__notified();
+}
+
+static void __rssi_changed_cb(network_info_rssi_e rssi, void* user_data)
+{
+	__notified();
+}
+
+static void __roaming_state_changed_cb(bool is_roaming, void* user_data)
+{
+	__notified();
+}
+
+static void __service_state_changed_cb(network_info_service_state_e network_service_state, void* user_data)
+{
+	__notified();
+}
+
+static void __provider_name_changed_cb(const char* provider_name, void* user_data)
+{
+	__notified();
+}
+
+static void __type_changed_cb(network_info_type_e network_type, void* user_data)
+{
+	__notified();
+}
+
+static void __plmn_changed_cb(const network_info_plmn_s* plmn, void* user_data)
+{
+	__notified();
+}
+
+static int __set_cell_id_changed_cb()
+{
+	return network_info_set_cell_id_changed_cb(__cell_id_changed_cb, NULL);
+}
+
+static int __set_rssi_changed_cb()
+{
+	return network_info_set_rssi_changed_cb(__rssi_changed_cb, NULL);
+}
+
+static int __set_roaming_state_changed_cb()
+{
+	return network_info_set_roaming_state_changed_cb(__roaming_state_changed_cb, NULL);
+}
+
+static int __set_service_state_changed_cb()
+{
+	return network_info_set_service_state_changed_cb(__service_state_changed_cb, NULL);
+}
+
+static int __set_provider_name_changed_cb()
+{
+	return network_info_set_provider_name_changed_cb(__provider_name_changed_cb, NULL);
+}
+
+static int __set_type_changed_cb()
+{
+	return network_info_set_type_changed_cb(__type_changed_cb, NULL);
+}
+
+static int __set_plmn_changed_cb()
+{
+	return network_info_set_plmn_changed_cb(__plmn_changed_cb, NULL);
+}
+
+// Each change i sets a value different from the change i - 1, and an even number of changes restores the value set by network_info_test_setup()
+static int __change_cell_id(int i)
+{
+	return network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_CELLID, i % 2 == 0 ? 2 : 1);
+}
+
+static int __change_rssi(int i)
+{
+	return network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_RSSI, i % 2 == 0 ? NETWORK_INFO_RSSI_3 : NETWORK_INFO_RSSI_4);
+}
+
+static int __change_roaming_state(int i)
+{
+	return network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVC_ROAM, i % 2 == 0 ? VCONFKEY_TELEPHONY_SVC_ROAM_ON : VCONFKEY_TELEPHONY_SVC_ROAM_OFF);
+}
+
+static int __change_service_state(int i)
+{
+	return network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVC_CS, i % 2 == 0 ? VCONFKEY_TELEPHONY_SVC_CS_OFF : VCONFKEY_TELEPHONY_SVC_CS_ON);
+}
+
+static int __change_provider_name(int i)
+{
+	return network_info_memory_backend_set_str(VCONFKEY_TELEPHONY_NWNAME, i % 2 == 0 ? "KT" : "SKTelecom");
+}
+
+static int __change_type(int i)
+{
+	return network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVCTYPE, i % 2 == 0 ? VCONFKEY_TELEPHONY_SVCTYPE_2G : VCONFKEY_TELEPHONY_SVCTYPE_3G);
+}
+
+static int __change_plmn(int i)
+{
+	return network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_PLMN, i % 2 == 0 ? 45008 : 45005);
+}
+
+typedef struct _bench_notification
+{
+	const char* name;
+	int (*set_cb)();
+	int (*unset_cb)();
+	int (*change)(int i);
+	int max_alloc_count;	// heap allocations allowed per change, for the string copied by the in-memory backend
+} bench_notification;
+
+static const bench_notification notifications[] =
+{
+	{"cell_id_changed_cb", __set_cell_id_changed_cb, network_info_unset_cell_id_changed_cb, __change_cell_id, 0},
+	{"rssi_changed_cb", __set_rssi_changed_cb, network_info_unset_rssi_changed_cb, __change_rssi, 0},
+	{"roaming_state_changed_cb", __set_roaming_state_changed_cb, network_info_unset_roaming_state_changed_cb, __change_roaming_state, 0},
+	{"service_state_changed_cb", __set_service_state_changed_cb, network_info_unset_service_state_changed_cb, __change_service_state, 0},
+	{"provider_name_changed_cb", __set_provider_name_changed_cb, network_info_unset_provider_name_changed_cb, __change_provider_name, 1},
+	{"type_changed_cb", __set_type_changed_cb, network_info_unset_type_changed_cb, __change_type, 0},
+	{"plmn_changed_cb", __set_plmn_changed_cb, network_info_unset_plmn_changed_cb, __change_plmn, 0}
+};
+
+static int __bench_getter(const bench_getter* getter, int count)
+{
+	unsigned long long read_count = 0;
+	gint64 start_time = 0;
+	gint64 elapsed_us = 0;
+	int start_alloc_count = 0;
+	int alloc_count_of_calls = 0;
+	int i = 0;
+
+	// the first call may set up the library
+	if( getter->call() != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "%s failed\n", getter->name);
+		return -1;
+	}
+
+	network_info_backend_reset_read_count();
+	start_alloc_count = g_atomic_int_get(&alloc_count);
+	start_time = g_get_monotonic_time();
+
+	for( i = 0; i < count; i++ )
+	{
+		if( getter->call() != NETWORK_INFO_ERROR_NONE )
+		{
+			fprintf(stderr, "%s failed\n", getter->name);
+			return -1;
+		}
+	}
+
+	elapsed_us = g_get_monotonic_time() - start_time;
+	alloc_count_of_calls = g_atomic_int_get(&alloc_count) - start_alloc_count;
+	network_info_backend_get_read_count(&read_count);
+
+	printf("%-16s %10.1f ns/call %12.0f calls/s %6.2f reads/call %6.2f allocs/call\n", getter->name,
+		elapsed_us * 1000.0 / count, elapsed_us > 0 ? count * 1000000.0 / elapsed_us : 0.0,
+		(double)read_count / count, (double)alloc_count_of_calls / count);
+
+	if( alloc_count_of_calls > getter->max_alloc_count * count )
+	{
+		fprintf(stderr, "%s made %d heap allocations in %d calls, expected at most %d per call\n", getter->name,
+			alloc_count_of_calls, count, getter->max_alloc_count);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int __bench_notification(const bench_notification* notification, int count)
+{
+	long long* latencies = g_new0(long long, count);
+	long long total_ns = 0;
+	long long changed_time = 0;
+	int start_alloc_count = 0;
+	int alloc_count_of_changes = 0;
+	int ret = 0;
+	int i = 0;
+
+	if( notification->set_cb() != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to set %s\n", notification->name);
+		g_free(latencies);
+		return -1;
+	}
+
+	start_alloc_count = g_atomic_int_get(&alloc_count);
+
+	for( i = 0; i < count && ret == 0; i++ )
+	{
+		notified_time = 0;
+		changed_time = network_info_test_get_time();
+
+		if( notification->change(i) != NETWORK_INFO_ERROR_NONE )
+		{
+			ret = -1;
+			break;
+		}
+
+		// some changes are delivered in the main loop
+		while( notified_time == 0 )
+		{
+			if( g_main_context_iteration(NULL, FALSE) == FALSE && notified_time == 0 && network_info_test_get_time() - changed_time > 1000000000LL )
+			{
+				fprintf(stderr, "%s is not invoked\n", notification->name);
+				ret = -1;
+				break;
+			}
+		}
+
+		latencies[i] = notified_time - changed_time;
+		total_ns += latencies[i];
+	}
+
+	alloc_count_of_changes = g_atomic_int_get(&alloc_count) - start_alloc_count;
+	notification->unset_cb();
+
+	if( ret == 0 )
+	{
+		qsort(latencies, count, sizeof(long long), network_info_test_compare_time);
+		printf("%-26s %8.0f ns mean %8lld ns p50 %8lld ns p99 %8lld ns max %6.2f allocs/change\n", notification->name,
+			(double)total_ns / count, latencies[count / 2], latencies[count * 99 / 100], latencies[count - 1],
+			(double)alloc_count_of_changes / count);
+
+		if( alloc_count_of_changes > notification->max_alloc_count * count )
+		{
+			fprintf(stderr, "%s made %d heap allocations in %d changes, expected at most %d per change\n", notification->name,
+				alloc_count_of_changes, count, notification->max_alloc_count);
+			ret = -1;
+		}
+	}
+
+	g_free(latencies);
+	return ret;
+}
+
+int main(int argc, char* argv[])
+{
+	int call_count = argc > 1 ? atoi(argv[1]) : 100000;
+	int change_count = argc > 2 ? atoi(argv[2]) : 1000;
+	int ret = 0;
+	int i = 0;
+
+	if( call_count < 1 || change_count < 1 )
+	{
+		fprintf(stderr, "usage: %s [calls per getter] [changes per callback function]\n", argv[0]);
+		return 2;
+	}
+
+	// an even number of changes restores the keys for the next callback function
+	change_count += change_count % 2;
+
+	if( network_info_test_setup() != 0 )
+	{
+		return 1;
+	}
+
+	printf("getters, backend reads\n");
+	for( i = 0; i < G_N_ELEMENTS(getters); i++ )
+	{
+		ret |= __bench_getter(&getters[i], call_count);
+	}
+
+	if( network_info_enable_cache() != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to enable the cache\n");
+		return 1;
+	}
+
+	printf("getters, cache\n");
+	for( i = 0; i < G_N_ELEMENTS(getters); i++ )
+	{
+		ret |= __bench_getter(&getters[i], call_count);
+	}
+
+	network_info_disable_cache();
+
+	printf("notifications\n");
+	for( i = 0; i < G_N_ELEMENTS(notifications); i++ )
+	{
+		ret |= __bench_notification(&notifications[i], change_count);
+	}
+
+	return ret == 0 ? 0 : 1;
+}
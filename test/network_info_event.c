@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Checks the delivery of the change events on the in-memory backend.
+// Each case starts and ends with no subscription, and with the keys of network_info_test_setup().
+//
+// Usage: network-info-event
+
+#include "network_info_test.h"
+#include <glib.h>
+#include <string.h>
+
+typedef struct _event_test_case
+{
+	const char* name;
+	int (*run)();
+} event_test_case;
+
+static int delivery_count = 0;
+static int last_value = 0;
+
+static void __int_cb(network_info_event_e event, void* data, void* user_data)
+{
+	delivery_count++;
+	last_value = *(int*)data;
+}
+
+// The events delivered only in service check the service state kept by their watches, so a notification reads no key
+static int __test_notification_reads_no_key()
+{
+	network_info_subscription_h rssi_subscription = NULL;
+	network_info_subscription_h cell_id_subscription = NULL;
+	unsigned long long read_count = 0;
+	int ret = 0;
+
+	if( network_info_subscribe(NETWORK_INFO_EVENT_RSSI, __int_cb, NULL, &rssi_subscription) != NETWORK_INFO_ERROR_NONE
+		|| network_info_subscribe(NETWORK_INFO_EVENT_CELL_ID, __int_cb, NULL, &cell_id_subscription) != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to subscribe\n");
+		return -1;
+	}
+
+	delivery_count = 0;
+	network_info_backend_reset_read_count();
+
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_RSSI, NETWORK_INFO_RSSI_2);
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_CELLID, 2);
+
+	network_info_backend_get_read_count(&read_count);
+	if( delivery_count != 2 || read_count != 0 )
+	{
+		fprintf(stderr, "%d deliveries with %llu reads, expected 2 deliveries without read\n", delivery_count, read_count);
+		ret = -1;
+	}
+
+	network_info_unsubscribe(cell_id_subscription);
+	network_info_unsubscribe(rssi_subscription);
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_RSSI, NETWORK_INFO_RSSI_4);
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_CELLID, 1);
+
+	return ret;
+}
+
+static int serving_cell_count = 0;
+static int last_serving_cell_id = 0;
+
+static void __serving_cell_cb(network_info_event_e event, void* data, void* user_data)
+{
+	serving_cell_count++;
+	last_serving_cell_id = ((network_info_serving_cell_s*)data)->cell_id;
+}
+
+// The serving cell is delivered from an idle source of the default main context
+static void __run_pending_deliveries()
+{
+	while( g_main_context_iteration(NULL, FALSE) == TRUE );
+}
+
+// A cell changed during an outage is delivered when the service returns
+static int __test_serving_cell_after_outage()
+{
+	network_info_subscription_h subscription = NULL;
+	int ret = 0;
+
+	if( network_info_subscribe(NETWORK_INFO_EVENT_SERVING_CELL, __serving_cell_cb, NULL, &subscription) != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to subscribe\n");
+		return -1;
+	}
+
+	serving_cell_count = 0;
+
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVC_CS, VCONFKEY_TELEPHONY_SVC_CS_OFF);
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_CELLID, 3);
+	__run_pending_deliveries();
+
+	if( serving_cell_count != 0 )
+	{
+		fprintf(stderr, "%d deliveries out of service, expected none\n", serving_cell_count);
+		ret = -1;
+	}
+
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVC_CS, VCONFKEY_TELEPHONY_SVC_CS_ON);
+	__run_pending_deliveries();
+
+	if( serving_cell_count != 1 || last_serving_cell_id != 3 )
+	{
+		fprintf(stderr, "%d deliveries of cell %d after the outage, expected 1 delivery of cell 3\n", serving_cell_count, last_serving_cell_id);
+		ret = -1;
+	}
+
+	network_info_unsubscribe(subscription);
+	network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_CELLID, 1);
+	__run_pending_deliveries();
+
+	return ret;
+}
+
+static void __provider_name_cb(network_info_event_e event, void* data, void* user_data)
+{
+	delivery_count++;
+}
+
+// The name is tracked only while its changes are subscribed, and read again once they are not.
+// The service state stays subscribed, so that the only read counted is the read of the name.
+static int __test_provider_name_after_unsubscribe()
+{
+	network_info_subscription_h service_state_subscription = NULL;
+	network_info_subscription_h subscription = NULL;
+	char provider_name[NETWORK_INFO_PROVIDER_NAME_LEN_MAX+1];
+	unsigned long long read_count = 0;
+	int ret = 0;
+
+	if( network_info_subscribe(NETWORK_INFO_EVENT_SERVICE_STATE, __int_cb, NULL, &service_state_subscription) != NETWORK_INFO_ERROR_NONE
+		|| network_info_subscribe(NETWORK_INFO_EVENT_PROVIDER_NAME, __provider_name_cb, NULL, &subscription) != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to subscribe\n");
+		return -1;
+	}
+
+	network_info_memory_backend_set_str(VCONFKEY_TELEPHONY_NWNAME, "KT");
+	network_info_backend_reset_read_count();
+
+	if( network_info_copy_provider_name(provider_name, sizeof(provider_name), NULL) != NETWORK_INFO_ERROR_NONE
+		|| network_info_backend_get_read_count(&read_count) != NETWORK_INFO_ERROR_NONE
+		|| strcmp(provider_name, "KT") != 0 || read_count != 0 )
+	{
+		fprintf(stderr, "copied \"%s\" with %llu reads while subscribed, expected \"KT\" without read\n", provider_name, read_count);
+		ret = -1;
+	}
+
+	network_info_unsubscribe(subscription);
+
+	// the name is not watched any more, so it is read
+	network_info_memory_backend_set_str(VCONFKEY_TELEPHONY_NWNAME, "LG");
+	network_info_backend_reset_read_count();
+
+	if( network_info_copy_provider_name(provider_name, sizeof(provider_name), NULL) != NETWORK_INFO_ERROR_NONE
+		|| network_info_backend_get_read_count(&read_count) != NETWORK_INFO_ERROR_NONE
+		|| strcmp(provider_name, "LG") != 0 || read_count != 1 )
+	{
+		fprintf(stderr, "copied \"%s\" with %llu reads after unsubscribing, expected \"LG\" with 1 read\n", provider_name, read_count);
+		ret = -1;
+	}
+
+	network_info_unsubscribe(service_state_subscription);
+
+	network_info_memory_backend_set_str(VCONFKEY_TELEPHONY_NWNAME, "SKTelecom");
+
+	return ret;
+}
+
+static const event_test_case test_cases[] =
+{
+	{"notification reads no key", __test_notification_reads_no_key},
+	{"serving cell after outage", __test_serving_cell_after_outage},
+	{"provider name after unsubscribe", __test_provider_name_after_unsubscribe}
+};
+
+int main(int argc, char* argv[])
+{
+	int ret = 0;
+	int i = 0;
+
+	if( network_info_test_setup() != 0 )
+	{
+		return 1;
+	}
+
+	for( i = 0; i < G_N_ELEMENTS(test_cases); i++ )
+	{
+		if( test_cases[i].run() != 0 )
+		{
+			printf("%s : FAILED\n", test_cases[i].name);
+			ret = -1;
+		}
+		else
+		{
+			printf("%s : PASSED\n", test_cases[i].name);
+		}
+	}
+
+	return ret == 0 ? 0 : 1;
+}
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Changes the keys of the in-memory backend at a given rate for a given time, while getter threads read them
+// and a churn thread subscribes and unsubscribes the cell ID change.
+// Two subscriptions of the cell ID change, one inline and one in the dispatch thread, must see the cell IDs only increase
+// and end with the last cell ID set.
+// Prints the deliveries per second and the latency from the change to the callback of the dispatch thread.
+//
+// Usage: network-info-soak [seconds] [changes per second, 0 for no wait] [getter threads]
+
+#include "network_info_test.h"
+#include <stdlib.h>
+#include <glib.h>
+
+// The times of each change take 16 bytes, so the number of changes is capped, which ends a soak with no wait early
+#define SOAK_CHANGE_COUNT_MAX (1 << 20)
+
+typedef struct _soak_getter
+{
+	GThread* thread;
+	unsigned long long calls;
+	bool is_failed;
+} soak_getter;
+
+// The cell ID i is set at change_times[i], and delivered to the dispatch thread at latencies[i] after it
+static long long* change_times = NULL;
+static long long* latencies = NULL;
+static int change_count = 0;
+
+static volatile gint is_stopped = 0;
+static volatile gint last_inline_cell_id = 0;
+static volatile gint last_queued_cell_id = 0;
+static volatile gint queued_delivery_count = 0;
+static volatile gint churn_delivery_count = 0;
+static volatile gint is_out_of_order = 0;
+
+// The changes are set by one thread, so each subscription must see the cell IDs only increase
+static void __check_order(const char* name, int previous_cell_id, int cell_id)
+{
+	if( cell_id <= previous_cell_id )
+	{
+		fprintf(stderr, "%s callback got cell ID %d after %d\n", name, cell_id, previous_cell_id);
+		g_atomic_int_set(&is_out_of_order, 1);
+	}
+}
+
+static void __inline_cb(network_info_event_e event, void* data, void* user_data)
+{
+	int cell_id = *(int*)data;
+
+	__check_order("inline", g_atomic_int_get(&last_inline_cell_id), cell_id);
+	g_atomic_int_set(&last_inline_cell_id, cell_id);
+}
+
+static void __queued_cb(network_info_event_e event, void* data, void* user_data)
+{
+	int cell_id = *(int*)data;
+
+	__check_order("dispatch thread", g_atomic_int_get(&last_queued_cell_id), cell_id);
+
+	if( cell_id > 0 && cell_id <= change_count )
+	{
+		latencies[cell_id] = network_info_test_get_time() - change_times[cell_id];
+	}
+
+	g_atomic_int_set(&last_queued_cell_id, cell_id);
+	g_atomic_int_inc(&queued_delivery_count);
+}
+
+// The user data is released right after network_info_unsubscribe(), so a late callback writes freed memory
+static void __churn_cb(network_info_event_e event, void* data, void* user_data)
+{
+	*(int*)user_data = *(int*)data;
+	g_atomic_int_inc(&churn_delivery_count);
+}
+
+static gpointer __getter_thread_func(gpointer data)
+{
+	soak_getter* getter = data;
+	network_info_snapshot_s snapshot;
+	char* provider_name = NULL;
+	int last_cell_id = 0;
+	int cell_id = 0;
+	int lac = 0;
+
+	while( !g_atomic_int_get(&is_stopped) )
+	{
+		if( network_info_get_cell_id(&cell_id) != NETWORK_INFO_ERROR_NONE
+			|| network_info_get_lac(&lac) != NETWORK_INFO_ERROR_NONE
+			|| network_info_get_snapshot(&snapshot) != NETWORK_INFO_ERROR_NONE
+			|| network_info_get_provider_name(&provider_name) != NETWORK_INFO_ERROR_NONE )
+		{
+			fprintf(stderr, "a getter failed\n");
+			getter->is_failed = true;
+			break;
+		}
+
+		free(provider_name);
+		provider_name = NULL;
+
+		if( cell_id < last_cell_id )
+		{
+			fprintf(stderr, "cell ID went back from %d to %d\n", last_cell_id, cell_id);
+			getter->is_failed = true;
+			break;
+		}
+
+		last_cell_id = cell_id;
+		getter->calls += 4;
+	}
+
+	return NULL;
+}
+
+static gpointer __churn_thread_func(gpointer data)
+{
+	network_info_subscription_h subscription = NULL;
+	unsigned long long* churn_count = data;
+	int* last_cell_id = NULL;
+
+	while( !g_atomic_int_get(&is_stopped) )
+	{
+		last_cell_id = g_new0(int, 1);
+
+		if( network_info_subscribe(NETWORK_INFO_EVENT_CELL_ID, __churn_cb, last_cell_id, &subscription) == NETWORK_INFO_ERROR_NONE )
+		{
+			// every other subscription is delivered in the dispatch thread
+			if( *churn_count % 2 == 1 )
+			{
+				network_info_subscription_set_dispatch_mode(subscription, NETWORK_INFO_DISPATCH_THREAD);
+			}
+			g_thread_yield();
+			network_info_unsubscribe(subscription);
+			(*churn_count)++;
+		}
+
+		g_free(last_cell_id);
+	}
+
+	return NULL;
+}
+
+// Sets the cell ID 1, 2, ... change_count, together with the other keys from time to time
+static gpointer __injector_thread_func(gpointer data)
+{
+	int rate = GPOINTER_TO_INT(data);
+	long long start_time = network_info_test_get_time();
+	long long due_time = 0;
+	long long now = 0;
+	int i = 0;
+
+	for( i = 1; i <= change_count; i++ )
+	{
+		if( rate > 0 )
+		{
+			due_time = start_time + (long long)(i - 1) * 1000000000LL / rate;
+			now = network_info_test_get_time();
+			if( due_time > now )
+			{
+				g_usleep((due_time - now) / 1000);
+			}
+		}
+
+		if( i % 16 == 0 )
+		{
+			network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_RSSI, i % 32 == 0 ? NETWORK_INFO_RSSI_3 : NETWORK_INFO_RSSI_4);
+			network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_LAC, i);
+		}
+
+		if( i % 256 == 0 )
+		{
+			network_info_memory_backend_set_str(VCONFKEY_TELEPHONY_NWNAME, i % 512 == 0 ? "KT" : "SKTelecom");
+		}
+
+		change_times[i] = network_info_test_get_time();
+		network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_CELLID, i);
+	}
+
+	return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+	int seconds = argc > 1 ? atoi(argv[1]) : 10;
+	int rate = argc > 2 ? atoi(argv[2]) : 10000;
+	int getter_count = argc > 3 ? atoi(argv[3]) : 4;
+	network_info_subscription_h inline_subscription = NULL;
+	network_info_subscription_h queued_subscription = NULL;
+	soak_getter* getters = NULL;
+	GThread* injector = NULL;
+	GThread* churn = NULL;
+	unsigned long long churn_count = 0;
+	unsigned long long getter_calls = 0;
+	long long start_time = 0;
+	long long elapsed_ns = 0;
+	long long* sorted_latencies = NULL;
+	int sorted_count = 0;
+	int backend_cell_id = 0;
+	int ret = 0;
+	int i = 0;
+
+	if( seconds < 1 || rate < 0 || getter_count < 0 )
+	{
+		fprintf(stderr, "usage: %s [seconds] [changes per second, 0 for no wait] [getter threads]\n", argv[0]);
+		return 2;
+	}
+
+	// with no wait, the changes are counted for a rate of one per microsecond
+	change_count = (int)MIN((long long)seconds * (rate > 0 ? rate : 1000000), SOAK_CHANGE_COUNT_MAX);
+	change_times = g_new0(long long, change_count + 1);
+	latencies = g_new0(long long, change_count + 1);
+
+	if( network_info_test_setup() != 0 )
+	{
+		return 1;
+	}
+
+	if( network_info_subscribe(NETWORK_INFO_EVENT_CELL_ID, __inline_cb, NULL, &inline_subscription) != NETWORK_INFO_ERROR_NONE
+		|| network_info_subscribe(NETWORK_INFO_EVENT_CELL_ID, __queued_cb, NULL, &queued_subscription) != NETWORK_INFO_ERROR_NONE
+		|| network_info_subscription_set_dispatch_mode(queued_subscription, NETWORK_INFO_DISPATCH_THREAD) != NETWORK_INFO_ERROR_NONE
+		|| network_info_enable_cache() != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to subscribe\n");
+		return 1;
+	}
+
+	getters = g_new0(soak_getter, getter_count);
+	for( i = 0; i < getter_count; i++ )
+	{
+		getters[i].thread = g_thread_new("soak-getter", __getter_thread_func, &getters[i]);
+	}
+	churn = g_thread_new("soak-churn", __churn_thread_func, &churn_count);
+
+	start_time = network_info_test_get_time();
+	injector = g_thread_new("soak-injector", __injector_thread_func, GINT_TO_POINTER(rate));
+	g_thread_join(injector);
+
+	// the dispatch thread may still be delivering the last changes
+	while( g_atomic_int_get(&last_queued_cell_id) != change_count && network_info_test_get_time() - start_time < (seconds + 10) * 1000000000LL )
+	{
+		g_usleep(1000);
+	}
+	elapsed_ns = network_info_test_get_time() - start_time;
+
+	g_atomic_int_set(&is_stopped, 1);
+	g_thread_join(churn);
+	for( i = 0; i < getter_count; i++ )
+	{
+		g_thread_join(getters[i].thread);
+		getter_calls += getters[i].calls;
+		if( getters[i].is_failed )
+		{
+			ret = -1;
+		}
+	}
+
+	network_info_get_cell_id(&backend_cell_id);
+	if( backend_cell_id != change_count || g_atomic_int_get(&last_inline_cell_id) != backend_cell_id || g_atomic_int_get(&last_queued_cell_id) != backend_cell_id )
+	{
+		fprintf(stderr, "last cell ID %d, delivered %d inline and %d in the dispatch thread\n", backend_cell_id,
+			g_atomic_int_get(&last_inline_cell_id), g_atomic_int_get(&last_queued_cell_id));
+		ret = -1;
+	}
+
+	if( g_atomic_int_get(&is_out_of_order) )
+	{
+		ret = -1;
+	}
+
+	sorted_latencies = g_new0(long long, change_count);
+	for( i = 1; i <= change_count; i++ )
+	{
+		if( latencies[i] > 0 )
+		{
+			sorted_latencies[sorted_count++] = latencies[i];
+		}
+	}
+	qsort(sorted_latencies, sorted_count, sizeof(long long), network_info_test_compare_time);
+
+	printf("changes %d in %.2f s, %.0f deliveries/s in the dispatch thread, %d deliveries to churned subscriptions, %llu churns\n",
+		change_count, elapsed_ns / 1000000000.0, g_atomic_int_get(&queued_delivery_count) * 1000000000.0 / elapsed_ns,
+		g_atomic_int_get(&churn_delivery_count), churn_count);
+	if( sorted_count > 0 )
+	{
+		printf("latency %lld ns p50, %lld ns p99, %lld ns max\n", sorted_latencies[sorted_count / 2],
+			sorted_latencies[(long long)sorted_count * 99 / 100], sorted_latencies[sorted_count - 1]);
+	}
+	printf("getters %.0f calls/s in %d threads\n", getter_calls * 1000000000.0 / elapsed_ns, getter_count);
+	printf("%s\n", ret == 0 ? "PASSED" : "FAILED");
+
+	network_info_disable_cache();
+	network_info_unsubscribe(queued_subscription);
+	network_info_unsubscribe(inline_subscription);
+	g_free(sorted_latencies);
+	g_free(getters);
+	g_free(latencies);
+	g_free(change_times);
+
+	return ret == 0 ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Runs the getters in 1, 2, 4, ... threads while another thread changes the LAC,
+// and prints the calls per second for each number of threads.
+// Fails if a getter fails, if a thread reads a LAC older than the one it read before,
+// or if the cached getters in the most threads do not scale as expected from the processors (see __check_scaling()).
+// The backend reads are not checked for scaling, because the in-memory backend serializes them with its lock.
+//
+// Usage: network-info-stress [max threads] [milliseconds per step]
+
+#include "network_info_test.h"
+#include <stdlib.h>
+#include <glib.h>
+
+typedef struct _stress_reader
+{
+	GThread* thread;
+	unsigned long long calls;
+	bool is_failed;
+} stress_reader;
+
+static volatile gint is_stopped = 0;
+
+// Part of the linear speedup which the cached getters must reach
+#define STRESS_SCALING_TOLERANCE 0.5
+
+static gpointer __reader_thread_func(gpointer data)
+{
+	stress_reader* reader = data;
+	network_info_rssi_e rssi = NETWORK_INFO_RSSI_0;
+	network_info_service_state_e service_state = NETWORK_INFO_SERVICE_STATE_OUT_OF_SERVICE;
+	int last_lac = 0;
+	int lac = 0;
+	int cell_id = 0;
+
+	while( !g_atomic_int_get(&is_stopped) )
+	{
+		if( network_info_get_lac(&lac) != NETWORK_INFO_ERROR_NONE
+			|| network_info_get_cell_id(&cell_id) != NETWORK_INFO_ERROR_NONE
+			|| network_info_get_rssi(&rssi) != NETWORK_INFO_ERROR_NONE
+			|| network_info_get_service_state(&service_state) != NETWORK_INFO_ERROR_NONE )
+		{
+			reader->is_failed = true;
+			break;
+		}
+
+		if( lac < last_lac )
+		{
+			fprintf(stderr, "LAC went back from %d to %d\n", last_lac, lac);
+			reader->is_failed = true;
+			break;
+		}
+
+		last_lac = lac;
+		reader->calls += 4;
+	}
+
+	return NULL;
+}
+
+static gpointer __writer_thread_func(gpointer data)
+{
+	int lac = 1;
+
+	while( !g_atomic_int_get(&is_stopped) )
+	{
+		network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_LAC, ++lac);
+	}
+
+	return NULL;
+}
+
+// Stores the calls per second in throughput
+static int __run_step(int thread_count, int duration_ms, double* throughput)
+{
+	stress_reader* readers = g_new0(stress_reader, thread_count);
+	GThread* writer = NULL;
+	unsigned long long calls = 0;
+	gint64 start_time = 0;
+	gint64 elapsed_us = 0;
+	int ret = 0;
+	int i = 0;
+
+	g_atomic_int_set(&is_stopped, 0);
+	writer = g_thread_new("stress-writer", __writer_thread_func, NULL);
+	start_time = g_get_monotonic_time();
+
+	for( i = 0; i < thread_count; i++ )
+	{
+		readers[i].thread = g_thread_new("stress-reader", __reader_thread_func, &readers[i]);
+	}
+
+	g_usleep(duration_ms * 1000);
+	g_atomic_int_set(&is_stopped, 1);
+
+	for( i = 0; i < thread_count; i++ )
+	{
+		g_thread_join(readers[i].thread);
+		calls += readers[i].calls;
+
+		if( readers[i].is_failed )
+		{
+			ret = -1;
+		}
+	}
+
+	elapsed_us = g_get_monotonic_time() - start_time;
+	g_thread_join(writer);
+
+	*throughput = calls * 1000000.0 / elapsed_us;
+	printf("threads %2d : %12.0f calls/s, %12.0f calls/s per thread%s\n", thread_count,
+		*throughput, *throughput / thread_count, ret == 0 ? "" : " FAILED");
+
+	g_free(readers);
+	return ret;
+}
+
+// The readers share the processors with the writer, so thread_count readers are expected to be
+// MIN(thread_count, processors - 1) times as fast as one reader. With one processor for the readers,
+// they are only expected not to slow down, which they would if the getters blocked each other.
+static int __check_scaling(int thread_count, double single_throughput, double throughput)
+{
+	int speedup = MIN(thread_count, MAX(g_get_num_processors() - 1, 1));
+	double expected_throughput = single_throughput * speedup * STRESS_SCALING_TOLERANCE;
+
+	if( throughput < expected_throughput )
+	{
+		fprintf(stderr, "%d threads made %.0f calls/s, expected at least %.0f calls/s for %d processors\n",
+			thread_count, throughput, expected_throughput, g_get_num_processors());
+		return -1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	int max_thread_count = argc > 1 ? atoi(argv[1]) : 8;
+	int duration_ms = argc > 2 ? atoi(argv[2]) : 500;
+	double single_throughput = 0;
+	double throughput = 0;
+	int thread_count = 0;
+	int ret = 0;
+
+	if( max_thread_count < 1 || duration_ms < 1 )
+	{
+		fprintf(stderr, "usage: %s [max threads] [milliseconds per step]\n", argv[0]);
+		return 2;
+	}
+
+	if( network_info_test_setup() != 0 )
+	{
+		return 1;
+	}
+
+	printf("backend reads\n");
+	for( thread_count = 1; thread_count <= max_thread_count; thread_count *= 2 )
+	{
+		ret |= __run_step(thread_count, duration_ms, &throughput);
+	}
+
+	if( network_info_enable_cache() != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to enable the cache\n");
+		return 1;
+	}
+
+	printf("cache\n");
+	for( thread_count = 1; thread_count <= max_thread_count; thread_count *= 2 )
+	{
+		ret |= __run_step(thread_count, duration_ms, &throughput);
+		if( thread_count == 1 )
+		{
+			single_throughput = throughput;
+		}
+	}
+
+	// the last step ran in the most threads
+	ret |= __check_scaling(thread_count / 2, single_throughput, throughput);
+
+	network_info_disable_cache();
+	return ret == 0 ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __TIZEN_TELEPHONY_NETWORK_INFO_TEST_H__
+#define __TIZEN_TELEPHONY_NETWORK_INFO_TEST_H__
+
+#include <telephony_network.h>
+#include <telephony_network_backend_private.h>
+#include <vconf-keys.h>
+#include <stdio.h>
+#include <time.h>
+
+// Chooses the in-memory backend and sets the keys of a 3G network in service
+static inline int network_info_test_setup()
+{
+	if( network_info_set_backend(NETWORK_INFO_BACKEND_MEMORY) != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to choose the in-memory backend\n");
+		return -1;
+	}
+
+	if( network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVCTYPE, VCONFKEY_TELEPHONY_SVCTYPE_3G) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVC_CS, VCONFKEY_TELEPHONY_SVC_CS_ON) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, false) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_LAC, 1) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_CELLID, 1) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_RSSI, NETWORK_INFO_RSSI_4) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_SVC_ROAM, VCONFKEY_TELEPHONY_SVC_ROAM_OFF) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_int(VCONFKEY_TELEPHONY_PLMN, 45005) != NETWORK_INFO_ERROR_NONE
+		|| network_info_memory_backend_set_str(VCONFKEY_TELEPHONY_NWNAME, "SKTelecom") != NETWORK_INFO_ERROR_NONE )
+	{
+		fprintf(stderr, "failed to set the keys\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+// Monotonic time in nanoseconds, since the deliveries take less than a microsecond of g_get_monotonic_time()
+static inline long long network_info_test_get_time()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+// Compares two times for qsort()
+static inline int network_info_test_compare_time(const void* a, const void* b)
+{
+	long long time_a = *(const long long*)a;
+	long long time_b = *(const long long*)b;
+
+	return (time_a > time_b) - (time_a < time_b);
+}
+
+#endif	// __TIZEN_TELEPHONY_NETWORK_INFO_TEST_H__